@@ -34,6 +34,10 @@
 
 #   define ELY_POSIX_API
 
+#   if defined ( __linux__ )
+#       define ELY_USING_LINUX_API
+#   endif
+
 #endif // windows API
 
 
@@ -125,6 +129,27 @@
 #endif // smart pointers
 
 
+//------------------------------------
+//          Hardware
+//------------------------------------
+
+// The size of a cache line, used to keep the data written by different threads apart
+#if ! defined ( ELY_CACHE_LINE_SIZE )
+
+#   define ELY_CACHE_LINE_SIZE  64
+
+#endif // cache line size
+
+// The x86 SIMD kernels are compiled with the target attributes of GCC and Clang and selected at run time
+#if ( defined ( __GNUC__ ) || defined ( __clang__ ) ) && \
+    ( defined ( __x86_64__ ) || defined ( __i386__ ) ) && \
+    ! defined ( ELY_NO_SIMD )
+
+#   define ELY_USING_X86_SIMD
+
+#endif // x86 SIMD
+
+
 //------------------------------------
 //          Global macros
 //------------------------------------
@@ -10,7 +10,7 @@
 
 
 #include <memory>
-#include <string>
+#include <string_view>
 
 
 #include "ely/file_system/Path.hpp"
@@ -33,9 +33,9 @@ public:
     AbstractFile( const Path & path = Path() );
     virtual ~AbstractFile() = default;
 
-    std::string getPath() const;
-    std::string getAccessPath() const noexcept;
-    std::string getName() const noexcept;
+    std::string_view getPath() const noexcept;
+    std::string_view getAccessPath() const noexcept;
+    std::string_view getName() const noexcept;
 
 private:
     /// The type of the path store by the object.
@@ -49,17 +49,17 @@ private:
 // Public inline functions
 //
 
-inline std::string AbstractFile::getPath() const
+inline std::string_view AbstractFile::getPath() const noexcept
 {
     return myPath->toString();
 }
 
-inline std::string AbstractFile::getAccessPath() const noexcept
+inline std::string_view AbstractFile::getAccessPath() const noexcept
 {
     return myPath->getAccessPath();
 }
 
-inline std::string AbstractFile::getName() const noexcept
+inline std::string_view AbstractFile::getName() const noexcept
 {
     return myPath->getName();
 }
@@ -0,0 +1,93 @@
+#include "ely/file_system/AlignedBuffer.hpp"
+
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Allocate a buffer.
+ *
+ * \param size        The minimum size of the buffer, rounded up to a multiple of \p alignment .
+ * \param alignment   The alignment, a power of two.
+ *
+ * \exception std::bad_alloc if the buffer can't be allocated.
+ */
+AlignedBuffer::AlignedBuffer( std::size_t size, std::size_t alignment )
+    : myData( nullptr ),
+    mySize( ( size + alignment - 1 ) / alignment * alignment ),
+    myAlignment( alignment )
+{
+    if ( 0 != mySize )
+    {
+        myData = static_cast< std::byte * >( std::aligned_alloc( myAlignment, mySize ) );
+
+        if ( nullptr == myData )
+        {
+            throw std::bad_alloc();
+        }
+    }
+}
+
+/*!
+ * \brief Constructor
+ *
+ * Move constructor : Constructs the object with the buffer of \p buffer , which is left empty.
+ *
+ * \param buffer  The \c AlignedBuffer object to move.
+ */
+AlignedBuffer::AlignedBuffer( AlignedBuffer && buffer ) noexcept
+    : myData( std::exchange( buffer.myData, nullptr ) ),
+    mySize( std::exchange( buffer.mySize, 0 ) ),
+    myAlignment( buffer.myAlignment )
+{}
+
+/*!
+ * \brief Destructor
+ *
+ * Release the buffer.
+ */
+AlignedBuffer::~AlignedBuffer()
+{
+    std::free( myData );
+}
+
+/*!
+ * \brief Move assignment operator
+ *
+ * Release the current buffer and take the buffer of \p buffer , which is left empty.
+ *
+ * \param buffer  The \c AlignedBuffer object to move.
+ *
+ * \return A reference on the current object.
+ */
+AlignedBuffer & AlignedBuffer::operator =( AlignedBuffer && buffer ) noexcept
+{
+    if ( this != &buffer )
+    {
+        std::free( myData );
+
+        myData = std::exchange( buffer.myData, nullptr );
+        mySize = std::exchange( buffer.mySize, 0 );
+        myAlignment = buffer.myAlignment;
+    }
+
+    return *this;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
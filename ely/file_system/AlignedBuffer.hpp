@@ -0,0 +1,115 @@
+/*!
+ * \file AlignedBuffer.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the AlignedBuffer class.
+ */
+#ifndef ALIGNED_BUFFER_HPP
+#define ALIGNED_BUFFER_HPP
+
+
+#include <cstddef>
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The AlignedBuffer class
+ *
+ * A buffer whose address and size are multiples of an alignment, as required by
+ * the files opened with \c OpenMode::Direct .
+ */
+class AlignedBuffer final
+{
+public:
+    static constexpr std::size_t defaultAlignment() noexcept;
+
+
+    explicit AlignedBuffer( std::size_t size, std::size_t alignment = defaultAlignment() );
+    AlignedBuffer( AlignedBuffer && buffer ) noexcept;
+    ~AlignedBuffer();
+
+    AlignedBuffer & operator =( AlignedBuffer && buffer ) noexcept;
+
+    AlignedBuffer( const AlignedBuffer & ) = delete;
+    AlignedBuffer & operator =( const AlignedBuffer & ) = delete;
+
+
+    std::byte * getData() noexcept;
+    const std::byte * getData() const noexcept;
+    std::size_t getSize() const noexcept;
+    std::size_t getAlignment() const noexcept;
+
+private:
+    std::byte * myData;
+    std::size_t mySize;
+    std::size_t myAlignment;
+};
+
+
+/*!
+ * \brief Constant accessor
+ *
+ * A page, which is a multiple of the logical block size of the devices.
+ *
+ * \return The default alignment of the buffers.
+ */
+constexpr std::size_t AlignedBuffer::defaultAlignment() noexcept
+{
+    return 4096;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The first byte of the buffer, \c nullptr if it has been moved.
+ */
+inline std::byte * AlignedBuffer::getData() noexcept
+{
+    return myData;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The first byte of the buffer, \c nullptr if it has been moved.
+ */
+inline const std::byte * AlignedBuffer::getData() const noexcept
+{
+    return myData;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the buffer, a multiple of the alignment.
+ */
+inline std::size_t AlignedBuffer::getSize() const noexcept
+{
+    return mySize;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The alignment of the address and the size of the buffer.
+ */
+inline std::size_t AlignedBuffer::getAlignment() const noexcept
+{
+    return myAlignment;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ALIGNED_BUFFER_HPP
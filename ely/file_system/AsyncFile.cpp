@@ -0,0 +1,217 @@
+#include "ely/file_system/AsyncFile.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cerrno>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create an \c AsyncFile to access the file \p filePath through \p context and try to open it.
+ *
+ * \param context     The context running the operations, must outlive the file.
+ * \param filePath    A \c FilePath object representing the path to the file.
+ * \param mode        How the file is opened, with \c OpenMode::Direct the buffers must be aligned.
+ */
+AsyncFile::AsyncFile( AsyncIoContext & context, const FilePath & filePath, OpenMode mode )
+    : myContext( context ),
+    myFilePath( filePath ),
+    myDescriptor( -1 ),
+    myError( 0 )
+{
+    const std::string pathString( myFilePath.toString() );
+
+    do
+    {
+        myDescriptor = ::open( pathString.c_str(), toOpenFlags( mode ), 0666 );
+    }
+    while ( ! isOpen() && EINTR == errno );
+
+    myError = isOpen() ? 0 : errno;
+}
+
+/*!
+ * \brief Constructor
+ *
+ * Move constructor : Constructs the object with the contents of \p file using the move semantics.\n
+ * \p file is left closed.
+ *
+ * \param file    The \c AsyncFile object to move.
+ */
+AsyncFile::AsyncFile( AsyncFile && file ) noexcept
+    : myContext( file.myContext ),
+    myFilePath( std::move( file.myFilePath ) ),
+    myDescriptor( std::exchange( file.myDescriptor, -1 ) ),
+    myError( file.myError )
+{}
+
+/*!
+ * \brief Destructor
+ *
+ * Close the file.
+ */
+AsyncFile::~AsyncFile()
+{
+    close();
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Close the file.
+ *
+ * The operations on the file must be completed.
+ */
+void AsyncFile::close() noexcept
+{
+    if ( isOpen() )
+    {
+        ::close( myDescriptor );
+        myDescriptor = -1;
+    }
+}
+
+/*!
+ * \brief Read a part of the file.
+ *
+ * \param offset      The offset of the part in the file.
+ * \param buffer      Receives the part.
+ * \param size        The size of the part.
+ * \param callback    Receives the number of bytes read, less than \p size at the end of the file, or the error.
+ */
+void AsyncFile::read( std::uint64_t offset, void * buffer, std::size_t size, Callback callback )
+{
+    myContext.read( myDescriptor, offset, buffer, size, std::move( callback ) );
+}
+
+/*!
+ * \brief Read a part of the file.
+ *
+ * \param offset      The offset of the part in the file.
+ * \param buffer      Receives the part.
+ * \param size        The size of the part.
+ *
+ * \return The future number of bytes read, less than \p size at the end of the file.
+ */
+std::future< std::size_t > AsyncFile::read( std::uint64_t offset, void * buffer, std::size_t size )
+{
+    std::promise< std::size_t > promise;
+    std::future< std::size_t > future = promise.get_future();
+
+    read( offset, buffer, size, toPromise( promise ) );
+
+    return future;
+}
+
+/*!
+ * \brief Write a part of the file.
+ *
+ * \param offset      The offset of the part in the file.
+ * \param buffer      The data to write.
+ * \param size        The size of the data.
+ * \param callback    Receives the number of bytes written or the error.
+ */
+void AsyncFile::write( std::uint64_t offset, const void * buffer, std::size_t size, Callback callback )
+{
+    myContext.write( myDescriptor, offset, buffer, size, std::move( callback ) );
+}
+
+/*!
+ * \brief Write a part of the file.
+ *
+ * \param offset      The offset of the part in the file.
+ * \param buffer      The data to write.
+ * \param size        The size of the data.
+ *
+ * \return The future number of bytes written.
+ */
+std::future< std::size_t > AsyncFile::write( std::uint64_t offset, const void * buffer, std::size_t size )
+{
+    std::promise< std::size_t > promise;
+    std::future< std::size_t > future = promise.get_future();
+
+    write( offset, buffer, size, toPromise( promise ) );
+
+    return future;
+}
+
+/*!
+ * \brief Read a part of the file in a registered buffer.
+ *
+ * \sa AsyncIoContext::readFixed()
+ */
+void AsyncFile::readFixed( std::uint64_t offset, void * buffer, std::size_t size, unsigned bufferIndex, Callback callback )
+{
+    myContext.readFixed( myDescriptor, offset, buffer, size, bufferIndex, std::move( callback ) );
+}
+
+/*!
+ * \brief Write a part of the file from a registered buffer.
+ *
+ * \sa AsyncIoContext::writeFixed()
+ */
+void AsyncFile::writeFixed( std::uint64_t offset, const void * buffer, std::size_t size, unsigned bufferIndex, Callback callback )
+{
+    myContext.writeFixed( myDescriptor, offset, buffer, size, bufferIndex, std::move( callback ) );
+}
+
+
+//
+// Private static functions
+//
+
+/*!
+ * \brief Get a callback fulfilling a promise.
+ *
+ * \param promise     The promise to fulfill, moved in the callback.
+ *
+ * \return The callback.
+ */
+AsyncFile::Callback AsyncFile::toPromise( std::promise< std::size_t > & promise )
+{
+    // A std::function must be copyable
+    std::shared_ptr< std::promise< std::size_t > > shared( new std::promise< std::size_t >( std::move( promise ) ) );
+
+    return [ shared ]( std::size_t size, std::error_code error )
+    {
+        if ( error )
+        {
+            shared->set_exception( std::make_exception_ptr( std::system_error( error ) ) );
+        }
+        else
+        {
+            shared->set_value( size );
+        }
+    };
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
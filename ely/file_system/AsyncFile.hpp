@@ -0,0 +1,133 @@
+/*!
+ * \file AsyncFile.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for read and write a file asynchronously.
+ */
+#ifndef ASYNC_FILE_HPP
+#define ASYNC_FILE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/AsyncIoContext.hpp"
+#include "ely/file_system/FilePath.hpp"
+#include "ely/file_system/OpenMode.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The AsyncFile class
+ *
+ * Reads and writes parts of a file asynchronously through an \c AsyncIoContext shared
+ * by many files.\n\n
+ *
+ * The result of an operation is given to a callback or by a \c std::future , whose \c get()
+ * throws a \c std::system_error on failure.\n
+ * With an \e io_uring the operations are only sent to the kernel by \c AsyncIoContext::submit() ,
+ * \c AsyncIoContext::wait() or when its queue is full : a future must not be waited before.\n
+ * The buffers must stay valid and the file open until the operations are completed.
+ */
+class AsyncFile final
+{
+public:
+    typedef AsyncIoContext::Callback Callback;
+
+
+    AsyncFile( AsyncIoContext & context, const FilePath & filePath, OpenMode mode = OpenMode::Read );
+    AsyncFile( AsyncFile && file ) noexcept;
+    ~AsyncFile();
+
+    AsyncFile( const AsyncFile & ) = delete;
+    AsyncFile & operator =( const AsyncFile & ) = delete;
+
+
+    bool isOpen() const noexcept;
+    void close() noexcept;
+
+    const FilePath & getPath() const noexcept;
+    int getDescriptor() const noexcept;
+    int getError() const noexcept;
+
+
+    void read( std::uint64_t offset, void * buffer, std::size_t size, Callback callback );
+    std::future< std::size_t > read( std::uint64_t offset, void * buffer, std::size_t size );
+    void write( std::uint64_t offset, const void * buffer, std::size_t size, Callback callback );
+    std::future< std::size_t > write( std::uint64_t offset, const void * buffer, std::size_t size );
+
+    void readFixed( std::uint64_t offset, void * buffer, std::size_t size, unsigned bufferIndex, Callback callback );
+    void writeFixed( std::uint64_t offset, const void * buffer, std::size_t size, unsigned bufferIndex, Callback callback );
+
+private:
+    static Callback toPromise( std::promise< std::size_t > & promise );
+
+
+    AsyncIoContext & myContext;
+    FilePath myFilePath;
+    int myDescriptor;
+    int myError;
+};
+
+
+/*!
+ * \brief Check if the file is open.
+ *
+ * \return \c true if the file is open, \c false otherwise.
+ */
+inline bool AsyncFile::isOpen() const noexcept
+{
+    return 0 <= myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return A constant reference on \c FilePath representing the path of the file.
+ */
+inline const FilePath & AsyncFile::getPath() const noexcept
+{
+    return myFilePath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The file descriptor of the file, negative if it's not open.
+ */
+inline int AsyncFile::getDescriptor() const noexcept
+{
+    return myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The \e errno value of the opening failure, \c 0 if there is none.
+ */
+inline int AsyncFile::getError() const noexcept
+{
+    return myError;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // ASYNC_FILE_HPP
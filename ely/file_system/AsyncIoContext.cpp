@@ -0,0 +1,740 @@
+#include "ely/file_system/AsyncIoContext.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+
+#include <unistd.h>
+
+#if defined ( ELY_USING_LINUX_API )
+#   include <linux/io_uring.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/// The maximum size of a read or a write, as for the system calls.
+constexpr std::size_t maximumTransferSize = 0x7ffff000;
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+/// The codes of the operations in the submission queue.
+constexpr std::uint8_t readCode = IORING_OP_READ;
+constexpr std::uint8_t writeCode = IORING_OP_WRITE;
+constexpr std::uint8_t readFixedCode = IORING_OP_READ_FIXED;
+constexpr std::uint8_t writeFixedCode = IORING_OP_WRITE_FIXED;
+
+#else
+
+// Only distinguish the operations, which are run by the pool of threads
+constexpr std::uint8_t readCode = 0;
+constexpr std::uint8_t writeCode = 1;
+constexpr std::uint8_t readFixedCode = 2;
+constexpr std::uint8_t writeFixedCode = 3;
+
+#endif // ELY_USING_LINUX_API
+
+
+/// The context whose callback is running in the thread, its operations don't wait for the limit of operations in flight.
+thread_local const AsyncIoContext * callingContext = nullptr;
+
+
+} // namespace
+
+
+/// An operation in flight, its address is the user data of the \e io_uring entries.
+struct AsyncIoContext::Operation
+{
+    Callback callback;
+};
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+/// The rings shared with the kernel, used without liburing.
+struct AsyncIoContext::Ring
+{
+    Ring() = default;
+    Ring( const Ring & ) = delete;
+    Ring & operator =( const Ring & ) = delete;
+
+    ~Ring()
+    {
+        if ( nullptr != sqes )
+        {
+            ::munmap( sqes, sqesSize );
+        }
+
+        if ( nullptr != cqRing && cqRing != sqRing )
+        {
+            ::munmap( cqRing, cqRingSize );
+        }
+
+        if ( nullptr != sqRing )
+        {
+            ::munmap( sqRing, sqRingSize );
+        }
+
+        if ( 0 <= descriptor )
+        {
+            ::close( descriptor );
+        }
+    }
+
+    /// Creates the rings, \c false if \e io_uring is unavailable.
+    bool setUp( unsigned entries ) noexcept
+    {
+        ::io_uring_params parameters;
+
+        std::memset( &parameters, 0, sizeof( parameters ) );
+        parameters.flags = IORING_SETUP_CLAMP;
+        descriptor = static_cast< int >( ::syscall( __NR_io_uring_setup, entries, &parameters ) );
+
+        if ( 0 > descriptor )
+        {
+            return false;
+        }
+
+        sqRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof( unsigned );
+        cqRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof( ::io_uring_cqe );
+
+        const bool isSingleMap = 0 != ( parameters.features & IORING_FEAT_SINGLE_MMAP );
+
+        if ( isSingleMap )
+        {
+            sqRingSize = cqRingSize = std::max( sqRingSize, cqRingSize );
+        }
+
+        sqRing = map( sqRingSize, IORING_OFF_SQ_RING );
+        cqRing = isSingleMap ? sqRing : map( cqRingSize, IORING_OFF_CQ_RING );
+        sqesSize = parameters.sq_entries * sizeof( ::io_uring_sqe );
+        sqes = static_cast< ::io_uring_sqe * >( map( sqesSize, IORING_OFF_SQES ) );
+
+        if ( nullptr == sqRing || nullptr == cqRing || nullptr == sqes )
+        {
+            return false;
+        }
+
+        char * const sq = static_cast< char * >( sqRing );
+        char * const cq = static_cast< char * >( cqRing );
+
+        sqHead = reinterpret_cast< unsigned * >( sq + parameters.sq_off.head );
+        sqTail = reinterpret_cast< unsigned * >( sq + parameters.sq_off.tail );
+        sqMask = *reinterpret_cast< unsigned * >( sq + parameters.sq_off.ring_mask );
+        sqArray = reinterpret_cast< unsigned * >( sq + parameters.sq_off.array );
+        sqEntries = parameters.sq_entries;
+        cqHead = reinterpret_cast< unsigned * >( cq + parameters.cq_off.head );
+        cqTail = reinterpret_cast< unsigned * >( cq + parameters.cq_off.tail );
+        cqMask = *reinterpret_cast< unsigned * >( cq + parameters.cq_off.ring_mask );
+        cqes = reinterpret_cast< ::io_uring_cqe * >( cq + parameters.cq_off.cqes );
+        cqEntries = parameters.cq_entries;
+
+        return true;
+    }
+
+    void * map( std::size_t size, off_t offset ) noexcept
+    {
+        void * address = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, offset );
+
+        return ( MAP_FAILED == address ) ? nullptr : address;
+    }
+
+
+    int descriptor = -1;
+
+    void * sqRing = nullptr;
+    std::size_t sqRingSize = 0;
+    ::io_uring_sqe * sqes = nullptr;
+    std::size_t sqesSize = 0;
+    unsigned * sqHead = nullptr;
+    unsigned * sqTail = nullptr;
+    unsigned * sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+
+    void * cqRing = nullptr;
+    std::size_t cqRingSize = 0;
+    ::io_uring_cqe * cqes = nullptr;
+    unsigned * cqHead = nullptr;
+    unsigned * cqTail = nullptr;
+    unsigned cqMask = 0;
+    unsigned cqEntries = 0;
+
+    /// The number of entries prepared and not submitted yet.
+    unsigned prepared = 0;
+};
+
+#else
+
+struct AsyncIoContext::Ring
+{
+};
+
+#endif // ELY_USING_LINUX_API
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create the \e io_uring if requested and available, else the pool of threads.
+ *
+ * \param queueDepth          The number of entries of the submission queue of the \e io_uring ,
+ *                            or the maximum number of operations in flight with the pool of threads.
+ * \param backend             The requested way to run the operations.
+ * \param numberOfThreads     The number of threads of the pool, when used.
+ */
+AsyncIoContext::AsyncIoContext( unsigned queueDepth, Backend backend, std::size_t numberOfThreads )
+    : myRing(),
+    myPool(),
+    myCompletionThread(),
+    myMutex(),
+    myCondition(),
+    myInFlight( 0 ),
+    myMaximumInFlight( 0 ),
+    myException()
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    if ( Backend::IoUring == backend )
+    {
+        std::unique_ptr< Ring > ring( new Ring );
+
+        if ( ring->setUp( std::max( queueDepth, 1u ) ) )
+        {
+            myRing = std::move( ring );
+            myMaximumInFlight = myRing->cqEntries;
+            myCompletionThread = std::thread( [ this ] { complete(); } );
+        }
+    }
+
+#else
+
+    static_cast< void >( queueDepth );
+    static_cast< void >( backend );
+
+#endif // ELY_USING_LINUX_API
+
+    if ( ! myRing )
+    {
+        myPool.reset( new utilities::WorkStealingThreadPool( numberOfThreads ) );
+        myMaximumInFlight = std::max( queueDepth, 1u );
+    }
+}
+
+/*!
+ * \brief Destructor
+ *
+ * Wait for every operation to be completed, an exception thrown by a callback is lost.
+ */
+AsyncIoContext::~AsyncIoContext()
+{
+    submit();
+    waitForOperations();
+
+#if defined ( ELY_USING_LINUX_API )
+
+    if ( myRing )
+    {
+        // A no operation entry without user data stops the completion thread
+        {
+            std::lock_guard< std::mutex > lock( myMutex );
+
+            push( IORING_OP_NOP, -1, 0, nullptr, 0, 0, 0 );
+            enter( myRing->prepared );
+        }
+
+        myCompletionThread.join();
+    }
+
+#endif // ELY_USING_LINUX_API
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Register buffers used by the fixed operations.
+ *
+ * The kernel maps the buffers once for all the operations. Can be done once.
+ *
+ * \param buffers     The buffers to register.
+ * \param count       The number of buffers.
+ *
+ * \return \c true if the buffers are registered or don't need to be, \c false otherwise.
+ *
+ * \sa readFixed()
+ * \sa writeFixed()
+ */
+bool AsyncIoContext::registerBuffers( const ::iovec * buffers, unsigned count )
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    if ( myRing )
+    {
+        return 0 == ::syscall( __NR_io_uring_register, myRing->descriptor, IORING_REGISTER_BUFFERS, buffers, count );
+    }
+
+#endif // ELY_USING_LINUX_API
+
+    static_cast< void >( buffers );
+    static_cast< void >( count );
+
+    return true;
+}
+
+/*!
+ * \brief Read a part of a file.
+ *
+ * \param descriptor  The descriptor of the file.
+ * \param offset      The offset of the part in the file.
+ * \param buffer      Receives the part, must be valid until the callback is called.
+ * \param size        The size of the part.
+ * \param callback    Receives the result.
+ */
+void AsyncIoContext::read( int descriptor, std::uint64_t offset, void * buffer, std::size_t size, Callback callback )
+{
+    if ( myRing )
+    {
+        prepare( readCode, descriptor, offset, buffer, size, 0, std::move( callback ) );
+    }
+    else
+    {
+        run( true, descriptor, offset, buffer, size, std::move( callback ) );
+    }
+}
+
+/*!
+ * \brief Write a part of a file.
+ *
+ * \param descriptor  The descriptor of the file.
+ * \param offset      The offset of the part in the file.
+ * \param buffer      The data to write, must be valid until the callback is called.
+ * \param size        The size of the data.
+ * \param callback    Receives the result.
+ */
+void AsyncIoContext::write( int descriptor, std::uint64_t offset, const void * buffer, std::size_t size, Callback callback )
+{
+    if ( myRing )
+    {
+        prepare( writeCode, descriptor, offset, buffer, size, 0, std::move( callback ) );
+    }
+    else
+    {
+        run( false, descriptor, offset, const_cast< void * >( buffer ), size, std::move( callback ) );
+    }
+}
+
+/*!
+ * \brief Read a part of a file in a registered buffer.
+ *
+ * \param descriptor  The descriptor of the file.
+ * \param offset      The offset of the part in the file.
+ * \param buffer      Receives the part, inside the registered buffer \p bufferIndex .
+ * \param size        The size of the part.
+ * \param bufferIndex The index of the registered buffer.
+ * \param callback    Receives the result.
+ *
+ * \sa registerBuffers()
+ */
+void AsyncIoContext::readFixed( int descriptor, std::uint64_t offset, void * buffer, std::size_t size,
+                                unsigned bufferIndex, Callback callback )
+{
+    if ( myRing )
+    {
+        prepare( readFixedCode, descriptor, offset, buffer, size, bufferIndex, std::move( callback ) );
+    }
+    else
+    {
+        run( true, descriptor, offset, buffer, size, std::move( callback ) );
+    }
+}
+
+/*!
+ * \brief Write a part of a file from a registered buffer.
+ *
+ * \param descriptor  The descriptor of the file.
+ * \param offset      The offset of the part in the file.
+ * \param buffer      The data to write, inside the registered buffer \p bufferIndex .
+ * \param size        The size of the data.
+ * \param bufferIndex The index of the registered buffer.
+ * \param callback    Receives the result.
+ *
+ * \sa registerBuffers()
+ */
+void AsyncIoContext::writeFixed( int descriptor, std::uint64_t offset, const void * buffer, std::size_t size,
+                                 unsigned bufferIndex, Callback callback )
+{
+    if ( myRing )
+    {
+        prepare( writeFixedCode, descriptor, offset, buffer, size, bufferIndex, std::move( callback ) );
+    }
+    else
+    {
+        run( false, descriptor, offset, const_cast< void * >( buffer ), size, std::move( callback ) );
+    }
+}
+
+/*!
+ * \brief Submit the prepared operations to the kernel with a single system call.
+ *
+ * Does nothing with the pool of threads, which runs the operations right away.
+ */
+void AsyncIoContext::submit()
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    if ( myRing )
+    {
+        std::lock_guard< std::mutex > lock( myMutex );
+
+        enter( myRing->prepared );
+    }
+
+#endif // ELY_USING_LINUX_API
+}
+
+/*!
+ * \brief Submit the prepared operations and wait for every operation to be completed.
+ *
+ * Must not be called by a callback.
+ *
+ * \exception The first exception thrown by a callback since the last call, once every operation is completed.
+ */
+void AsyncIoContext::wait()
+{
+    submit();
+
+    std::exception_ptr exception = waitForOperations();
+
+    if ( exception )
+    {
+        std::rethrow_exception( exception );
+    }
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Prepare an operation in the submission queue.
+ *
+ * Waits while too many operations are in flight, except in a callback.
+ */
+void AsyncIoContext::prepare( std::uint8_t opcode, int descriptor, std::uint64_t offset, const void * buffer,
+                              std::size_t size, unsigned bufferIndex, Callback callback )
+{
+    std::unique_ptr< Operation > operation( new Operation{ std::move( callback ) } );
+    std::unique_lock< std::mutex > lock( myMutex );
+
+    waitForRoom( lock );
+
+    push( opcode, descriptor, offset, buffer, size, bufferIndex, reinterpret_cast< std::uintptr_t >( operation.get() ) );
+    operation.release();
+    ++myInFlight;
+}
+
+/*!
+ * \brief Write an entry in the submission queue, submitting the queue first if it is full.
+ *
+ * Must be called with the mutex locked.
+ */
+void AsyncIoContext::push( std::uint8_t opcode, int descriptor, std::uint64_t offset, const void * buffer,
+                           std::size_t size, unsigned bufferIndex, std::uint64_t userData )
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    Ring & ring = *myRing;
+    const unsigned tail = *ring.sqTail;
+
+    if ( tail - __atomic_load_n( ring.sqHead, __ATOMIC_ACQUIRE ) == ring.sqEntries )
+    {
+        enter( ring.prepared );
+    }
+
+    const unsigned index = tail & ring.sqMask;
+    ::io_uring_sqe & entry = ring.sqes[ index ];
+
+    std::memset( &entry, 0, sizeof( entry ) );
+    entry.opcode = opcode;
+    entry.fd = descriptor;
+    entry.off = offset;
+    entry.addr = reinterpret_cast< std::uintptr_t >( buffer );
+    entry.len = static_cast< std::uint32_t >( std::min( size, maximumTransferSize ) );
+    entry.buf_index = static_cast< std::uint16_t >( bufferIndex );
+    entry.user_data = userData;
+
+    ring.sqArray[ index ] = index;
+    __atomic_store_n( ring.sqTail, tail + 1, __ATOMIC_RELEASE );
+    ++ring.prepared;
+
+#else
+
+    static_cast< void >( opcode );
+    static_cast< void >( descriptor );
+    static_cast< void >( offset );
+    static_cast< void >( buffer );
+    static_cast< void >( size );
+    static_cast< void >( bufferIndex );
+    static_cast< void >( userData );
+
+#endif // ELY_USING_LINUX_API
+}
+
+/*!
+ * \brief Run an operation in the pool of threads.
+ *
+ * Waits while too many operations are in flight, except in a callback.
+ */
+void AsyncIoContext::run( bool isRead, int descriptor, std::uint64_t offset, void * buffer, std::size_t size, Callback callback )
+{
+    {
+        std::unique_lock< std::mutex > lock( myMutex );
+
+        waitForRoom( lock );
+        ++myInFlight;
+    }
+
+    myPool->submit( [ this, isRead, descriptor, offset, buffer, size, callback = std::move( callback ) ]
+    {
+        const std::size_t clampedSize = std::min( size, maximumTransferSize );
+        const off_t position = static_cast< off_t >( offset );
+        ssize_t result;
+
+        do
+        {
+            result = isRead ? ::pread( descriptor, buffer, clampedSize, position )
+                            : ::pwrite( descriptor, buffer, clampedSize, position );
+        }
+        while ( 0 > result && EINTR == errno );
+
+        if ( 0 <= result )
+        {
+            call( callback, static_cast< std::size_t >( result ), std::error_code() );
+        }
+        else
+        {
+            call( callback, 0, std::error_code( errno, std::system_category() ) );
+        }
+
+        finish( 1 );
+    } );
+}
+
+/*!
+ * \brief Submit the prepared entries.
+ *
+ * Must be called with the mutex locked.
+ *
+ * \exception std::system_error if the \e io_uring refuses the entries.
+ */
+void AsyncIoContext::enter( unsigned toSubmit )
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    while ( 0 < toSubmit )
+    {
+        const long submitted = ::syscall( __NR_io_uring_enter, myRing->descriptor, toSubmit, 0, 0, nullptr, 0 );
+
+        if ( 0 <= submitted )
+        {
+            toSubmit -= static_cast< unsigned >( submitted );
+            myRing->prepared -= static_cast< unsigned >( submitted );
+        }
+        else if ( EAGAIN == errno || EBUSY == errno )
+        {
+            std::this_thread::yield();
+        }
+        else if ( EINTR != errno )
+        {
+            throw std::system_error( errno, std::system_category(), "io_uring_enter" );
+        }
+    }
+
+#else
+
+    static_cast< void >( toSubmit );
+
+#endif // ELY_USING_LINUX_API
+}
+
+/*!
+ * \brief The loop of the completion thread, calling the callbacks of the completed operations.
+ */
+void AsyncIoContext::complete()
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    Ring & ring = *myRing;
+    bool isStopping = false;
+
+    while ( ! isStopping )
+    {
+        // Interrupted or busy waits only go through the completions and wait again
+        if ( 0 > ::syscall( __NR_io_uring_enter, ring.descriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0 ) &&
+             EINTR != errno && EAGAIN != errno && EBUSY != errno )
+        {
+            // The kernel still completes the operations : poll the completions instead of waiting for them
+            keepException( std::make_exception_ptr( std::system_error( errno, std::system_category(), "io_uring_enter" ) ) );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+
+        unsigned head = *ring.cqHead;
+        const unsigned tail = __atomic_load_n( ring.cqTail, __ATOMIC_ACQUIRE );
+        std::size_t count = 0;
+
+        // The kernel orders the operations after their submission, the mutex makes it visible to the language
+        {
+            std::lock_guard< std::mutex > lock( myMutex );
+        }
+
+        for ( ; head != tail; ++head )
+        {
+            const ::io_uring_cqe & entry = ring.cqes[ head & ring.cqMask ];
+
+            if ( 0 == entry.user_data )
+            {
+                isStopping = true;
+
+                continue;
+            }
+
+            const std::unique_ptr< Operation > operation( reinterpret_cast< Operation * >( entry.user_data ) );
+
+            if ( 0 <= entry.res )
+            {
+                call( operation->callback, static_cast< std::size_t >( entry.res ), std::error_code() );
+            }
+            else
+            {
+                call( operation->callback, 0, std::error_code( -entry.res, std::system_category() ) );
+            }
+
+            ++count;
+        }
+
+        __atomic_store_n( ring.cqHead, head, __ATOMIC_RELEASE );
+        finish( count );
+    }
+
+#endif // ELY_USING_LINUX_API
+}
+
+/*!
+ * \brief Call the callback of a completed operation.
+ *
+ * Keeps the exception thrown by the callback for \c wait() , so the completions of
+ * the other operations are still counted.
+ *
+ * \param callback    The callback of the operation.
+ * \param size        The number of bytes transferred.
+ * \param error       The error of the operation.
+ */
+void AsyncIoContext::call( const Callback & callback, std::size_t size, std::error_code error ) noexcept
+{
+    const AsyncIoContext * const previousContext = callingContext;
+
+    callingContext = this;
+
+    try
+    {
+        callback( size, error );
+    }
+    catch ( ... )
+    {
+        keepException( std::current_exception() );
+    }
+
+    callingContext = previousContext;
+}
+
+/*!
+ * \brief Keep an exception for \c wait() , only the first one is kept.
+ *
+ * \param exception   The exception to keep.
+ */
+void AsyncIoContext::keepException( std::exception_ptr exception ) noexcept
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    if ( ! myException )
+    {
+        myException = std::move( exception );
+    }
+}
+
+/*!
+ * \brief Wait while too many operations are in flight.
+ *
+ * Doesn't wait in a callback of the context, which would wait for its own completion.
+ *
+ * \param lock    The lock of the mutex, locked.
+ */
+void AsyncIoContext::waitForRoom( std::unique_lock< std::mutex > & lock )
+{
+    if ( this != callingContext )
+    {
+        myCondition.wait( lock, [ this ] { return myInFlight < myMaximumInFlight; } );
+    }
+}
+
+/*!
+ * \brief Wait for every operation to be completed.
+ *
+ * \return The first exception thrown by a callback since the last call, \c nullptr if none.
+ */
+std::exception_ptr AsyncIoContext::waitForOperations()
+{
+    std::unique_lock< std::mutex > lock( myMutex );
+
+    myCondition.wait( lock, [ this ] { return 0 == myInFlight; } );
+
+    return std::exchange( myException, nullptr );
+}
+
+/*!
+ * \brief Count completed operations and wake up the waiting threads.
+ *
+ * \param count   The number of completed operations.
+ */
+void AsyncIoContext::finish( std::size_t count ) noexcept
+{
+    if ( 0 < count )
+    {
+        // Notified under the lock : the context can be destroyed as soon as a waiting thread sees no operation
+        std::lock_guard< std::mutex > lock( myMutex );
+
+        myInFlight -= count;
+        myCondition.notify_all();
+    }
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,163 @@
+/*!
+ * \file AsyncIoContext.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the AsyncIoContext class.
+ */
+#ifndef ASYNC_IO_CONTEXT_HPP
+#define ASYNC_IO_CONTEXT_HPP
+
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/utilities/WorkStealingThreadPool.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <sys/uio.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The AsyncIoContext class
+ *
+ * Runs reads and writes at given offsets of files asynchronously, and calls a callback
+ * with the result of each operation.\n\n
+ *
+ * On Linux the operations go through an \e io_uring : they are prepared in the submission
+ * queue shared with the kernel and sent together by a single system call when \c submit()
+ * is called or the queue is full, and one thread calls the callbacks of the completed ones.\n
+ * Buffers registered with \c registerBuffers() are mapped once by the kernel instead of at
+ * each operation.\n
+ * When \e io_uring is unavailable, or not requested, the operations are run right away
+ * with \e pread and \e pwrite by a \c WorkStealingThreadPool .\n\n
+ *
+ * Thousands of operations can be in flight without a thread each : once the number of
+ * operations in flight reaches \c getMaximumInFlight() , new operations wait for completions.\n
+ * The callbacks must be short, they can be called concurrently with the pool of threads.\n
+ * The first exception thrown by a callback is rethrown by \c wait() .
+ *
+ * \sa AsyncFile
+ */
+class AsyncIoContext final
+{
+public:
+    /// The way the operations are run.
+    enum class Backend
+    {
+        IoUring,
+        ThreadPool
+    };
+
+    /// Receives the number of bytes transferred, maybe less than requested, or the error.
+    typedef std::function< void( std::size_t, std::error_code ) > Callback;
+
+
+    explicit AsyncIoContext( unsigned queueDepth = 256,
+                             Backend backend = Backend::IoUring,
+                             std::size_t numberOfThreads = 4 );
+    ~AsyncIoContext();
+
+    AsyncIoContext( const AsyncIoContext & ) = delete;
+    AsyncIoContext & operator =( const AsyncIoContext & ) = delete;
+
+
+    Backend getBackend() const noexcept;
+    std::size_t getMaximumInFlight() const noexcept;
+
+
+    bool registerBuffers( const ::iovec * buffers, unsigned count );
+
+    void read( int descriptor, std::uint64_t offset, void * buffer, std::size_t size, Callback callback );
+    void write( int descriptor, std::uint64_t offset, const void * buffer, std::size_t size, Callback callback );
+    void readFixed( int descriptor, std::uint64_t offset, void * buffer, std::size_t size,
+                    unsigned bufferIndex, Callback callback );
+    void writeFixed( int descriptor, std::uint64_t offset, const void * buffer, std::size_t size,
+                     unsigned bufferIndex, Callback callback );
+
+    void submit();
+    void wait();
+
+private:
+    struct Ring;
+    struct Operation;
+
+
+    void prepare( std::uint8_t opcode, int descriptor, std::uint64_t offset, const void * buffer,
+                  std::size_t size, unsigned bufferIndex, Callback callback );
+    void push( std::uint8_t opcode, int descriptor, std::uint64_t offset, const void * buffer,
+               std::size_t size, unsigned bufferIndex, std::uint64_t userData );
+    void run( bool isRead, int descriptor, std::uint64_t offset, void * buffer, std::size_t size, Callback callback );
+    void enter( unsigned toSubmit );
+    void complete();
+    void call( const Callback & callback, std::size_t size, std::error_code error ) noexcept;
+    void keepException( std::exception_ptr exception ) noexcept;
+    void waitForRoom( std::unique_lock< std::mutex > & lock );
+    std::exception_ptr waitForOperations();
+    void finish( std::size_t count ) noexcept;
+
+
+    std::unique_ptr< Ring > myRing;
+    std::unique_ptr< utilities::WorkStealingThreadPool > myPool;
+    std::thread myCompletionThread;
+
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    std::size_t myInFlight;
+    std::size_t myMaximumInFlight;
+    /// The first exception thrown by a callback, rethrown by \c wait() .
+    std::exception_ptr myException;
+};
+
+
+/*!
+ * \brief Accessor
+ *
+ * \return The way the operations are run.
+ */
+inline AsyncIoContext::Backend AsyncIoContext::getBackend() const noexcept
+{
+    return myRing ? Backend::IoUring : Backend::ThreadPool;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * The limit is not applied to the operations started by the callbacks,
+ * which would wait for their own completion.
+ *
+ * \return The maximum number of operations in flight.
+ */
+inline std::size_t AsyncIoContext::getMaximumInFlight() const noexcept
+{
+    return myMaximumInFlight;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // ASYNC_IO_CONTEXT_HPP
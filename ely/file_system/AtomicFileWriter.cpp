@@ -0,0 +1,508 @@
+#include "ely/file_system/AtomicFileWriter.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <utility>
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/*!
+ * \brief Make the content of a file durable.
+ *
+ * The metadata not needed to read the content, as the times, may not be synced.
+ *
+ * \param descriptor  The file descriptor of the file.
+ *
+ * \return The \e errno value of the failure, \c 0 on success.
+ */
+int syncData( int descriptor ) noexcept
+{
+#if defined ( ELY_USING_LINUX_API )
+    return ( 0 == ::fdatasync( descriptor ) ) ? 0 : errno;
+#else
+    return ( 0 == ::fsync( descriptor ) ) ? 0 : errno;
+#endif
+}
+
+/*!
+ * \brief Start writing the content of a file on the device, without waiting for it.
+ *
+ * Started on every file of a batch before any of them is synced, the writebacks overlap.
+ *
+ * \param descriptor  The file descriptor of the file.
+ *
+ * \return The \e errno value of the failure, \c 0 on success.
+ */
+int startWriteback( int descriptor ) noexcept
+{
+#if defined ( ELY_USING_LINUX_API )
+    return ( 0 == ::sync_file_range( descriptor, 0, 0, SYNC_FILE_RANGE_WRITE ) ) ? 0 : errno;
+#else
+    static_cast< void >( descriptor );
+
+    return 0;
+#endif
+}
+
+/*!
+ * \brief Make the entries of a directory durable.
+ *
+ * \param directoryPath   The path of the directory.
+ *
+ * \return The \e errno value of the failure, \c 0 on success.
+ */
+int syncDirectory( const std::string & directoryPath ) noexcept
+{
+    const int descriptor = ::open( directoryPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+
+    if ( -1 == descriptor )
+    {
+        return errno;
+    }
+
+    const int error = ( 0 == ::fsync( descriptor ) ) ? 0 : errno;
+
+    ::close( descriptor );
+
+    return error;
+}
+
+
+} // namespace
+
+
+//
+// AtomicFileWriter constructors && destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create the temporary file next to \p filePath .\n
+ * The temporary file gets the permissions of the file if it exists, else \p permissions .
+ *
+ * \param filePath        A \c FilePath object representing the path of the file to replace.
+ * \param permissions     The permissions of a new file.
+ *
+ * \sa getError()
+ */
+AtomicFileWriter::AtomicFileWriter( const FilePath & filePath, ::mode_t permissions )
+    : myFilePath( filePath ),
+    myTemporaryPath( myFilePath.getAccessPath() ),
+    myDescriptor( -1 ),
+    myIsCommitted( false ),
+    myError()
+{
+    if ( myTemporaryPath.empty() || ( '/' != myTemporaryPath.back() ) )
+    {
+        myTemporaryPath += '/';
+    }
+
+    // Hidden, and unique even for the writers of the same file
+    myTemporaryPath += '.';
+    myTemporaryPath += myFilePath.getName();
+    myTemporaryPath += ".XXXXXX";
+
+    myDescriptor = ::mkostemp( myTemporaryPath.data(), O_CLOEXEC );
+
+    if ( -1 == myDescriptor )
+    {
+        myTemporaryPath.clear();
+        fail( errno );
+
+        return;
+    }
+
+    struct stat status;
+
+    if ( 0 == ::stat( std::string( myFilePath.toString() ).c_str(), &status ) )
+    {
+        permissions = status.st_mode & 07777;
+    }
+
+    if ( 0 != ::fchmod( myDescriptor, permissions ) )
+    {
+        fail( errno );
+        discard();
+    }
+}
+
+/*!
+ * \brief Destructor
+ *
+ * Remove the temporary file if the content was not committed.
+ */
+AtomicFileWriter::~AtomicFileWriter()
+{
+    discard();
+}
+
+
+//
+// AtomicFileWriter public functions
+//
+
+/*!
+ * \brief Write data in the temporary file.
+ *
+ * \param data    The data to write.
+ * \param size    The size of the data.
+ *
+ * \return \c true if the data was written, \c false on failure.
+ */
+bool AtomicFileWriter::write( const void * data, std::size_t size )
+{
+    if ( myError )
+    {
+        return false;
+    }
+
+    if ( ! isOpen() )
+    {
+        return fail( EBADF );
+    }
+
+    const char * first = static_cast< const char * >( data );
+
+    while ( 0 != size )
+    {
+        const ::ssize_t written = ::write( myDescriptor, first, size );
+
+        if ( 0 < written )
+        {
+            first += written;
+            size -= static_cast< std::size_t >( written );
+        }
+        else if ( 0 == written )
+        {
+            return fail( EIO );
+        }
+        else if ( EINTR != errno )
+        {
+            return fail( errno );
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Replace the file with the content written.
+ *
+ * The temporary file is synced and renamed over the file, then the directory is synced.\n
+ * If only the syncing of the directory fails, the file is replaced but not durably yet.
+ *
+ * \return \c true if the file was replaced durably, \c false otherwise.
+ *
+ * \sa Group::commit()
+ */
+bool AtomicFileWriter::commit()
+{
+    if ( myError )
+    {
+        return false;
+    }
+
+    if ( ! isOpen() )
+    {
+        return myIsCommitted || fail( EBADF );
+    }
+
+    const int syncError = syncData( myDescriptor );
+
+    if ( 0 != syncError )
+    {
+        return fail( syncError );
+    }
+
+    if ( ! rename() )
+    {
+        return false;
+    }
+
+    close();
+
+    const int error = syncDirectory( std::string( myFilePath.getAccessPath() ) );
+
+    return ( 0 == error ) || fail( error );
+}
+
+/*!
+ * \brief Give up the content written.
+ *
+ * The temporary file is closed and removed, the file is unchanged.\n
+ * Nothing is done once the content is committed.
+ */
+void AtomicFileWriter::discard() noexcept
+{
+    close();
+
+    if ( ! myIsCommitted && ! myTemporaryPath.empty() )
+    {
+        ::unlink( myTemporaryPath.c_str() );
+        myTemporaryPath.clear();
+    }
+}
+
+
+//
+// AtomicFileWriter private functions
+//
+
+/*!
+ * \brief Rename the temporary file over the file.
+ *
+ * The temporary file is removed on failure.
+ *
+ * \return \c true if the file was replaced, \c false otherwise.
+ */
+bool AtomicFileWriter::rename()
+{
+    if ( 0 != ::rename( myTemporaryPath.c_str(), std::string( myFilePath.toString() ).c_str() ) )
+    {
+        const int error = errno;
+
+        discard();
+
+        return fail( error );
+    }
+
+    myIsCommitted = true;
+
+    return true;
+}
+
+/*!
+ * \brief Close the temporary file.
+ */
+void AtomicFileWriter::close() noexcept
+{
+    if ( isOpen() )
+    {
+        ::close( myDescriptor );
+        myDescriptor = -1;
+    }
+}
+
+/*!
+ * \brief Keep a failure.
+ *
+ * \param error   The \e errno value of the failure.
+ *
+ * \return \c false .
+ */
+bool AtomicFileWriter::fail( int error ) noexcept
+{
+    if ( ! myError )
+    {
+        myError.assign( error, std::system_category() );
+    }
+
+    return false;
+}
+
+
+//
+// AtomicFileWriter::Group constructors
+//
+
+/*!
+ * \brief Constructor
+ */
+AtomicFileWriter::Group::Group() noexcept
+    : myMutex(),
+    myBatchDone(),
+    myPendingRequests(),
+    myIsCommitting( false ),
+    myNumberOfBatches( 0 )
+{}
+
+
+//
+// AtomicFileWriter::Group public functions
+//
+
+/*!
+ * \brief Commit writers.
+ *
+ * The writers join the next batch and the call returns once the batch is committed.\n
+ * Each writer keeps its own failure, the others are committed anyway.
+ *
+ * \param writers     The writers to commit.
+ * \param count       The number of writers.
+ *
+ * \return \c true if every file was replaced durably, \c false otherwise.
+ */
+bool AtomicFileWriter::Group::commit( AtomicFileWriter * const * writers, std::size_t count )
+{
+    Request request { writers, count, false };
+    std::unique_lock< std::mutex > lock( myMutex );
+
+    myPendingRequests.push_back( &request );
+
+    while ( ! request.isDone )
+    {
+        if ( myIsCommitting )
+        {
+            myBatchDone.wait( lock );
+            continue;
+        }
+
+        // This thread commits the requests pending, its own included
+        std::vector< Request * > batch;
+
+        batch.swap( myPendingRequests );
+        myIsCommitting = true;
+        lock.unlock();
+
+        commitBatch( batch );
+        myNumberOfBatches.fetch_add( 1, std::memory_order_relaxed );
+
+        lock.lock();
+
+        for ( Request * done : batch )
+        {
+            done->isDone = true;
+        }
+
+        myIsCommitting = false;
+        myBatchDone.notify_all();
+    }
+
+    lock.unlock();
+
+    return std::all_of( writers, writers + count, []( const AtomicFileWriter * writer )
+    {
+        return writer->isCommitted() && ! writer->getError();
+    } );
+}
+
+
+//
+// AtomicFileWriter::Group private functions
+//
+
+/*!
+ * \brief Commit the writers of a batch.
+ *
+ * \param batch   The requests of the batch.
+ */
+void AtomicFileWriter::Group::commitBatch( const std::vector< Request * > & batch ) noexcept
+{
+    std::vector< AtomicFileWriter * > writers;
+
+    for ( const Request * request : batch )
+    {
+        for ( std::size_t i = 0; i < request->count; ++i )
+        {
+            AtomicFileWriter * writer = request->writers[ i ];
+
+            if ( writer->isOpen() && ! writer->myError )
+            {
+                writers.push_back( writer );
+            }
+            else if ( ! writer->isCommitted() )
+            {
+                writer->fail( EBADF );
+            }
+        }
+    }
+
+    const auto dropFailed = [ &writers ]
+    {
+        writers.erase( std::remove_if( writers.begin(), writers.end(), []( const AtomicFileWriter * writer )
+        {
+            return static_cast< bool >( writer->myError );
+        } ), writers.end() );
+    };
+
+    // Every writeback is started before waiting for the first one
+    for ( AtomicFileWriter * writer : writers )
+    {
+        const int error = startWriteback( writer->myDescriptor );
+
+        if ( 0 != error )
+        {
+            writer->fail( error );
+        }
+    }
+
+    dropFailed();
+
+    for ( AtomicFileWriter * writer : writers )
+    {
+        const int error = syncData( writer->myDescriptor );
+
+        if ( 0 != error )
+        {
+            writer->fail( error );
+        }
+    }
+
+    dropFailed();
+
+    for ( AtomicFileWriter * writer : writers )
+    {
+        writer->rename();
+    }
+
+    dropFailed();
+
+    // One fsync per directory
+    std::vector< std::pair< std::string, AtomicFileWriter * > > directories;
+
+    for ( AtomicFileWriter * writer : writers )
+    {
+        directories.emplace_back( writer->myFilePath.getAccessPath(), writer );
+    }
+
+    std::sort( directories.begin(), directories.end(), []( const auto & first, const auto & second )
+    {
+        return first.first < second.first;
+    } );
+
+    for ( auto first = directories.begin(); first != directories.end(); )
+    {
+        const auto last = std::find_if( first, directories.end(), [ first ]( const auto & directory )
+        {
+            return directory.first != first->first;
+        } );
+        const int error = syncDirectory( first->first );
+
+        if ( 0 != error )
+        {
+            std::for_each( first, last, [ error ]( const auto & directory ) { directory.second->fail( error ); } );
+        }
+
+        first = last;
+    }
+
+    for ( AtomicFileWriter * writer : writers )
+    {
+        writer->close();
+    }
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,261 @@
+/*!
+ * \file AtomicFileWriter.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the AtomicFileWriter class.
+ */
+#ifndef ATOMIC_FILE_WRITER_HPP
+#define ATOMIC_FILE_WRITER_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/FilePath.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <sys/types.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The AtomicFileWriter class
+ *
+ * Replaces the content of a file atomically.\n\n
+ *
+ * The new content is written in a temporary file of the same directory. \c commit() makes it
+ * durable with \e fdatasync , renames it over the file and makes the renaming durable by syncing
+ * the directory : after a crash, the file has either its former or its new content, never a part of it.\n
+ * The temporary file is removed when the writer is destroyed without being committed.\n
+ * The first failure is kept : the following writes do nothing and the commit fails.\n\n
+ *
+ * Many files can be committed together through a \c Group , their syncs overlap and each directory
+ * is synced once for all of them.
+ */
+class AtomicFileWriter final
+{
+public:
+    class Group;
+
+
+    explicit AtomicFileWriter( const FilePath & filePath, ::mode_t permissions = 0644 );
+    ~AtomicFileWriter();
+
+    AtomicFileWriter( const AtomicFileWriter & ) = delete;
+    AtomicFileWriter & operator =( const AtomicFileWriter & ) = delete;
+
+
+    bool write( const void * data, std::size_t size );
+    bool write( std::string_view data );
+
+    bool commit();
+    void discard() noexcept;
+
+
+    const FilePath & getPath() const noexcept;
+    const std::string & getTemporaryPath() const noexcept;
+    int getDescriptor() const noexcept;
+    bool isOpen() const noexcept;
+    bool isCommitted() const noexcept;
+    std::error_code getError() const noexcept;
+
+private:
+    bool rename();
+    void close() noexcept;
+    bool fail( int error ) noexcept;
+
+
+    FilePath myFilePath;
+    std::string myTemporaryPath;
+    int myDescriptor;
+    bool myIsCommitted;
+    std::error_code myError;
+};
+
+
+/*!
+ * \brief The AtomicFileWriter::Group class
+ *
+ * Commits many writers with a group commit.\n\n
+ *
+ * The writers committed while a batch is synced wait for it and form the next batch, committed
+ * by one of their threads. On Linux the writeback of every temporary file is started with
+ * \e sync_file_range first, so the devices write them together, then each file is synced with
+ * \e fdatasync , which mostly waits for the writeback already running. The files are renamed
+ * once all of them are durable, then each directory of the batch is synced once, whatever the
+ * number of its files.\n
+ * A \e syncfs per file system would need fewer calls, but it waits for every dirty page of the
+ * file system, written by any process, and reports the writeback errors only since Linux 5.8 :
+ * syncing the files of the batch bounds the wait to their data and reports the failures of each file.\n
+ * The group can be shared by many threads.
+ */
+class AtomicFileWriter::Group final
+{
+public:
+    Group() noexcept;
+
+    Group( const Group & ) = delete;
+    Group & operator =( const Group & ) = delete;
+
+
+    bool commit( AtomicFileWriter & writer );
+    bool commit( AtomicFileWriter * const * writers, std::size_t count );
+
+
+    std::uint64_t getNumberOfBatches() const noexcept;
+
+private:
+    /// The writers of a call to commit().
+    struct Request
+    {
+        AtomicFileWriter * const * writers;
+        std::size_t count;
+        bool isDone;
+    };
+
+
+    static void commitBatch( const std::vector< Request * > & batch ) noexcept;
+
+
+    std::mutex myMutex;
+    std::condition_variable myBatchDone;
+    std::vector< Request * > myPendingRequests;
+    bool myIsCommitting;
+    std::atomic< std::uint64_t > myNumberOfBatches;
+};
+
+
+//
+// AtomicFileWriter inline functions
+//
+
+/*!
+ * \brief Write a string.
+ *
+ * \param data    The string to write.
+ *
+ * \return \c true if the data was written, \c false on failure.
+ */
+inline bool AtomicFileWriter::write( std::string_view data )
+{
+    return write( data.data(), data.size() );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return A constant reference on \c FilePath representing the path of the file replaced.
+ */
+inline const FilePath & AtomicFileWriter::getPath() const noexcept
+{
+    return myFilePath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The path of the temporary file.
+ */
+inline const std::string & AtomicFileWriter::getTemporaryPath() const noexcept
+{
+    return myTemporaryPath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The file descriptor of the temporary file, \c -1 if it is closed.
+ */
+inline int AtomicFileWriter::getDescriptor() const noexcept
+{
+    return myDescriptor;
+}
+
+/*!
+ * \brief Check if the temporary file is open.
+ *
+ * \return \c true if the content can be written and committed, \c false otherwise.
+ */
+inline bool AtomicFileWriter::isOpen() const noexcept
+{
+    return -1 != myDescriptor;
+}
+
+/*!
+ * \brief Check if the content was committed.
+ *
+ * \return \c true if the file was replaced, \c false otherwise.
+ */
+inline bool AtomicFileWriter::isCommitted() const noexcept
+{
+    return myIsCommitted;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The first failure, empty if there is none.
+ */
+inline std::error_code AtomicFileWriter::getError() const noexcept
+{
+    return myError;
+}
+
+
+//
+// AtomicFileWriter::Group inline functions
+//
+
+/*!
+ * \brief Commit a writer.
+ *
+ * \param writer  The writer to commit.
+ *
+ * \return \c true if the file was replaced durably, \c false otherwise.
+ *
+ * \sa commit( AtomicFileWriter * const *, std::size_t )
+ */
+inline bool AtomicFileWriter::Group::commit( AtomicFileWriter & writer )
+{
+    AtomicFileWriter * const writers[] = { &writer };
+
+    return commit( writers, 1 );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of batches committed.
+ */
+inline std::uint64_t AtomicFileWriter::Group::getNumberOfBatches() const noexcept
+{
+    return myNumberOfBatches.load( std::memory_order_relaxed );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // ATOMIC_FILE_WRITER_HPP
@@ -0,0 +1,259 @@
+#include "ely/file_system/BufferedWriter.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+#if defined ( IOV_MAX )
+/// The maximum number of buffers given to \e writev .
+constexpr std::size_t maximumVectorSize = IOV_MAX;
+#else
+constexpr std::size_t maximumVectorSize = 1024;
+#endif
+
+
+} // namespace
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a writer writing at the current position of \p file .
+ *
+ * \param file        The open file to write, must outlive the writer.
+ * \param bufferSize  The size of the buffer.
+ */
+BufferedWriter::BufferedWriter( File & file, std::size_t bufferSize )
+    : myFile( file ),
+    myBufferSize( bufferSize ),
+    myBuffer( new char[ bufferSize ] ),
+    myBufferedSize( 0 ),
+    myWrittenSize( 0 ),
+    myError()
+{}
+
+/*!
+ * \brief Destructor
+ *
+ * Write the content of the buffer, a failure is lost.
+ */
+BufferedWriter::~BufferedWriter()
+{
+    flush();
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Write data.
+ *
+ * \param data    The data to write.
+ * \param size    The size of the data.
+ *
+ * \return \c true if the data was buffered or written, \c false on failure.
+ */
+bool BufferedWriter::write( const void * data, std::size_t size )
+{
+    const ::iovec buffer = { const_cast< void * >( data ), size };
+
+    return write( &buffer, 1 );
+}
+
+/*!
+ * \brief Write the data of several buffers.
+ *
+ * The buffers are copied in the buffer if they fit in, otherwise they are written
+ * with the content of the buffer without being copied.
+ *
+ * \param buffers     The buffers to write.
+ * \param count       The number of buffers.
+ *
+ * \return \c true if the data was buffered or written, \c false on failure.
+ */
+bool BufferedWriter::write( const ::iovec * buffers, std::size_t count )
+{
+    if ( myError )
+    {
+        return false;
+    }
+
+    std::size_t size = 0;
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        size += buffers[ i ].iov_len;
+    }
+
+    if ( size > myBufferSize - myBufferedSize )
+    {
+        return writeBufferAnd( buffers, count );
+    }
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        if ( 0 != buffers[ i ].iov_len )
+        {
+            std::memcpy( myBuffer.get() + myBufferedSize, buffers[ i ].iov_base, buffers[ i ].iov_len );
+            myBufferedSize += buffers[ i ].iov_len;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Write the content of the buffer in the file.
+ *
+ * \return \c true if every data was written, \c false on failure.
+ *
+ * \sa getError()
+ */
+bool BufferedWriter::flush()
+{
+    if ( myError )
+    {
+        return false;
+    }
+
+    return ( 0 == myBufferedSize ) || writeBufferAnd( nullptr, 0 );
+}
+
+/*!
+ * \brief Write the content of the buffer and the data of the file on the device.
+ *
+ * \return \c true if every data is on the device, \c false on failure.
+ *
+ * \sa getError()
+ */
+bool BufferedWriter::sync()
+{
+    if ( ! flush() )
+    {
+        return false;
+    }
+
+    return myFile.sync() || fail( myFile.getError() );
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Write the content of the buffer followed by buffers of the user with \e writev .
+ *
+ * \param buffers     The buffers to write after the content of the buffer.
+ * \param count       The number of buffers.
+ *
+ * \return \c true if every data was written, \c false on failure.
+ */
+bool BufferedWriter::writeBufferAnd( const ::iovec * buffers, std::size_t count )
+{
+    std::vector< ::iovec > vectors;
+
+    vectors.reserve( count + 1 );
+
+    if ( 0 != myBufferedSize )
+    {
+        vectors.push_back( ::iovec{ myBuffer.get(), myBufferedSize } );
+    }
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        if ( 0 != buffers[ i ].iov_len )
+        {
+            vectors.push_back( buffers[ i ] );
+        }
+    }
+
+    // The buffer is emptied whatever the result, its content is either written or lost with the failure
+    myBufferedSize = 0;
+
+    ::iovec * first = vectors.data();
+    ::iovec * const last = vectors.data() + vectors.size();
+
+    while ( first != last )
+    {
+        const int vectorSize = static_cast< int >( std::min( maximumVectorSize, static_cast< std::size_t >( last - first ) ) );
+        ssize_t written = ::writev( myFile.getDescriptor(), first, vectorSize );
+
+        if ( 0 > written )
+        {
+            if ( EINTR == errno )
+            {
+                continue;
+            }
+
+            return fail( errno );
+        }
+
+        if ( 0 == written )
+        {
+            return fail( EIO );
+        }
+
+        myWrittenSize += static_cast< std::uint64_t >( written );
+
+        // Skip the buffers completely written and advance in the partially written one
+        while ( first != last && static_cast< std::size_t >( written ) >= first->iov_len )
+        {
+            written -= static_cast< ssize_t >( first->iov_len );
+            ++first;
+        }
+
+        if ( first != last )
+        {
+            first->iov_base = static_cast< char * >( first->iov_base ) + written;
+            first->iov_len -= static_cast< std::size_t >( written );
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Keep a failure.
+ *
+ * \param error   The \e errno value of the failure.
+ *
+ * \return \c false .
+ */
+bool BufferedWriter::fail( int error ) noexcept
+{
+    myError.assign( error, std::system_category() );
+
+    return false;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,156 @@
+/*!
+ * \file BufferedWriter.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the BufferedWriter class.
+ */
+#ifndef BUFFERED_WRITER_HPP
+#define BUFFERED_WRITER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <system_error>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/File.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <sys/uio.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The BufferedWriter class
+ *
+ * Writes binary data in a \c File through a large buffer.\n\n
+ *
+ * The data is copied in the buffer while it fits. Otherwise the content of the buffer and
+ * the new data are written together by a single \e writev , without copying the new data.\n
+ * The first failure is kept : the following writes do nothing and return \c false , so
+ * a failure can be checked once at the end with \c flush() and \c getError() .\n
+ * The destructor flushes the buffer but can't report a failure.
+ */
+class BufferedWriter final
+{
+public:
+    static constexpr std::size_t defaultBufferSize() noexcept;
+
+
+    explicit BufferedWriter( File & file, std::size_t bufferSize = defaultBufferSize() );
+    ~BufferedWriter();
+
+    BufferedWriter( const BufferedWriter & ) = delete;
+    BufferedWriter & operator =( const BufferedWriter & ) = delete;
+
+
+    bool write( const void * data, std::size_t size );
+    bool write( std::string_view data );
+    bool write( const ::iovec * buffers, std::size_t count );
+
+    bool flush();
+    bool sync();
+
+
+    std::size_t getBufferSize() const noexcept;
+    std::size_t getBufferedSize() const noexcept;
+    std::uint64_t getWrittenSize() const noexcept;
+    std::error_code getError() const noexcept;
+
+private:
+    bool writeBufferAnd( const ::iovec * buffers, std::size_t count );
+    bool fail( int error ) noexcept;
+
+
+    File & myFile;
+    const std::size_t myBufferSize;
+    const std::unique_ptr< char[] > myBuffer;
+    std::size_t myBufferedSize;
+    std::uint64_t myWrittenSize;
+    std::error_code myError;
+};
+
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default size of the buffer.
+ */
+constexpr std::size_t BufferedWriter::defaultBufferSize() noexcept
+{
+    return 1024 * 1024;
+}
+
+/*!
+ * \brief Write a string.
+ *
+ * \param data    The string to write.
+ *
+ * \return \c true if the data was buffered or written, \c false on failure.
+ */
+inline bool BufferedWriter::write( std::string_view data )
+{
+    return write( data.data(), data.size() );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the buffer.
+ */
+inline std::size_t BufferedWriter::getBufferSize() const noexcept
+{
+    return myBufferSize;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the data in the buffer, not written yet.
+ */
+inline std::size_t BufferedWriter::getBufferedSize() const noexcept
+{
+    return myBufferedSize;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the data written in the file.
+ */
+inline std::uint64_t BufferedWriter::getWrittenSize() const noexcept
+{
+    return myWrittenSize;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The first failure, empty if there is none.
+ */
+inline std::error_code BufferedWriter::getError() const noexcept
+{
+    return myError;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // BUFFERED_WRITER_HPP
@@ -0,0 +1,113 @@
+#include "ely/file_system/ChunkedReader.hpp"
+
+
+#include <algorithm>
+#include <cstdint>
+
+
+#include "ely/file_system/separators.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * \param content     The content to split, must outlive the reader.
+ * \param delimiter   The delimiter ending the records.
+ */
+ChunkedReader::ChunkedReader( std::string_view content, char delimiter ) noexcept
+    : myContent( content ),
+    myDelimiter( delimiter )
+{}
+
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief Constructor
+ *
+ * \param file        The mapped file to split, must outlive the reader.
+ * \param delimiter   The delimiter ending the records.
+ */
+ChunkedReader::ChunkedReader( const MappedFile & file, char delimiter ) noexcept
+    : ChunkedReader( file.getContent(), delimiter )
+{}
+
+#endif // ELY_POSIX_API
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Split the content in chunks of whole records.
+ *
+ * The content is cut every \c 1 / \p numberOfChunks of its size and each cut is moved after
+ * the next delimiter.\n
+ * Less chunks are made if some records are longer than a chunk, an empty content has no chunk.
+ *
+ * \param numberOfChunks  The number of chunks wanted.
+ *
+ * \return The chunks, in the order of the content.
+ */
+std::vector< ChunkedReader::Chunk > ChunkedReader::split( std::size_t numberOfChunks ) const
+{
+    const std::size_t size = myContent.size();
+    std::vector< Chunk > chunks;
+
+    numberOfChunks = std::clamp< std::size_t >( numberOfChunks, 1, std::max< std::size_t >( size, 1 ) );
+    chunks.reserve( numberOfChunks );
+
+    std::size_t begin = 0;
+
+    for ( std::size_t i = 1; ( i <= numberOfChunks ) && ( begin < size ); ++i )
+    {
+        std::size_t end = size;
+
+        if ( i < numberOfChunks )
+        {
+            const std::size_t target = static_cast< std::size_t >( static_cast< std::uint64_t >( size ) * i / numberOfChunks );
+            const std::size_t position = separators::findFirst( myContent, myDelimiter, myDelimiter, std::max( target, begin ) );
+
+            if ( std::string_view::npos != position )
+            {
+                end = position + 1;
+            }
+        }
+
+        chunks.push_back( { chunks.size(), begin, myContent.substr( begin, end - begin ) } );
+        begin = end;
+    }
+
+    return chunks;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Get the number of chunks made when none is given.
+ *
+ * \param pool    The threads processing the chunks.
+ *
+ * \return A few chunks per thread, to balance the load.
+ */
+std::size_t ChunkedReader::defaultNumberOfChunks( const utilities::WorkStealingThreadPool & pool ) noexcept
+{
+    return 4 * std::max< std::size_t >( pool.getNumberOfThreads(), 1 );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
@@ -0,0 +1,233 @@
+/*!
+ * \file ChunkedReader.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the ChunkedReader class.
+ */
+#ifndef CHUNKED_READER_HPP
+#define CHUNKED_READER_HPP
+
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/MappedFile.hpp"
+#include "ely/utilities/WorkStealingThreadPool.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The ChunkedReader class
+ *
+ * Splits a large content in chunks of whole records to process them in parallel.\n\n
+ *
+ * The content is cut in byte ranges of about the same size, each range is extended
+ * up to the next delimiter so that no record is shared by two chunks.\n
+ * The chunks are processed by the tasks of a \c WorkStealingThreadPool and their results
+ * are merged on the calling thread in the order of the chunks, as soon as they are ready.\n
+ * More chunks than threads are made by default so that the threads stay busy while the
+ * records are of uneven costs.\n\n
+ *
+ * A \c MappedFile is read in place, the content must outlive the reader.
+ */
+class ChunkedReader final
+{
+public:
+    /// A range of whole records.
+    struct Chunk
+    {
+        /// The rank of the chunk in the content.
+        std::size_t index;
+        /// The offset of the chunk in the content.
+        std::size_t offset;
+        /// The records, with the delimiter ending the last one if any.
+        std::string_view data;
+    };
+
+
+    explicit ChunkedReader( std::string_view content, char delimiter = '\n' ) noexcept;
+#if defined ( ELY_POSIX_API )
+    explicit ChunkedReader( const MappedFile & file, char delimiter = '\n' ) noexcept;
+#endif
+
+
+    std::string_view getContent() const noexcept;
+    char getDelimiter() const noexcept;
+
+    std::vector< Chunk > split( std::size_t numberOfChunks ) const;
+
+    template < typename Function, typename Merge >
+    void process( utilities::WorkStealingThreadPool & pool, Function function, Merge merge,
+                  std::size_t numberOfChunks = 0 ) const;
+    template < typename Function >
+    std::vector< std::invoke_result_t< Function &, const Chunk & > >
+    process( utilities::WorkStealingThreadPool & pool, Function function, std::size_t numberOfChunks = 0 ) const;
+
+private:
+    static std::size_t defaultNumberOfChunks( const utilities::WorkStealingThreadPool & pool ) noexcept;
+
+
+    std::string_view myContent;
+    char myDelimiter;
+};
+
+
+/*!
+ * \brief Accessor
+ *
+ * \return The content split in chunks.
+ */
+inline std::string_view ChunkedReader::getContent() const noexcept
+{
+    return myContent;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The delimiter ending the records.
+ */
+inline char ChunkedReader::getDelimiter() const noexcept
+{
+    return myDelimiter;
+}
+
+
+template < typename Function, typename Merge >
+/*!
+ * \brief Process the chunks in parallel and merge their results in order.
+ *
+ * \p function is called concurrently on the threads of \p pool with each chunk,
+ * \p merge is called on the calling thread with the result of each chunk, in the order of the chunks.\n
+ * If \p function or \p merge throws, the remaining results are not merged and the first exception
+ * is rethrown once every task is finished.\n
+ * The call waits for every task of \p pool , it must not be made from one of them.
+ *
+ * \param pool            The threads processing the chunks.
+ * \param function        The processing of a chunk, called as \c function( const Chunk & ) .
+ * \param merge           The merging of a result, called as \c merge( Result && ) .
+ * \param numberOfChunks  The number of chunks, \c 0 to let the reader choose it.
+ */
+void ChunkedReader::process( utilities::WorkStealingThreadPool & pool, Function function, Merge merge,
+                             std::size_t numberOfChunks ) const
+{
+    typedef std::invoke_result_t< Function &, const Chunk & > Result;
+
+    /// The result of a chunk.
+    struct Slot
+    {
+        std::optional< Result > result;
+        std::exception_ptr exception;
+        bool isReady = false;
+    };
+
+    const std::vector< Chunk > chunks = split( ( 0 != numberOfChunks ) ? numberOfChunks : defaultNumberOfChunks( pool ) );
+    std::vector< Slot > slots( chunks.size() );
+    std::mutex mutex;
+    std::condition_variable ready;
+
+    for ( const Chunk & chunk : chunks )
+    {
+        pool.submit( [ &, index = chunk.index ]
+        {
+            Slot & slot = slots[ index ];
+
+            try
+            {
+                slot.result.emplace( function( chunks[ index ] ) );
+            }
+            catch ( ... )
+            {
+                slot.exception = std::current_exception();
+            }
+
+            std::lock_guard< std::mutex > lock( mutex );
+
+            slot.isReady = true;
+            ready.notify_all();
+        } );
+    }
+
+    std::exception_ptr exception;
+
+    try
+    {
+        for ( Slot & slot : slots )
+        {
+            {
+                std::unique_lock< std::mutex > lock( mutex );
+
+                ready.wait( lock, [ &slot ] { return slot.isReady; } );
+            }
+
+            if ( slot.exception )
+            {
+                std::rethrow_exception( slot.exception );
+            }
+
+            merge( std::move( *slot.result ) );
+            slot.result.reset();
+        }
+    }
+    catch ( ... )
+    {
+        exception = std::current_exception();
+    }
+
+    // The tasks refer to the local variables
+    pool.wait();
+
+    if ( exception )
+    {
+        std::rethrow_exception( exception );
+    }
+}
+
+template < typename Function >
+/*!
+ * \brief Process the chunks in parallel and collect their results in order.
+ *
+ * \param pool            The threads processing the chunks.
+ * \param function        The processing of a chunk, called concurrently as \c function( const Chunk & ) .
+ * \param numberOfChunks  The number of chunks, \c 0 to let the reader choose it.
+ *
+ * \return The results of the chunks, in the order of the chunks.
+ *
+ * \sa process( utilities::WorkStealingThreadPool &, Function, Merge, std::size_t )
+ */
+std::vector< std::invoke_result_t< Function &, const ChunkedReader::Chunk & > >
+ChunkedReader::process( utilities::WorkStealingThreadPool & pool, Function function, std::size_t numberOfChunks ) const
+{
+    typedef std::invoke_result_t< Function &, const Chunk & > Result;
+
+    std::vector< Result > results;
+
+    process( pool, std::move( function ), [ &results ]( Result && result )
+    {
+        results.push_back( std::move( result ) );
+    }, numberOfChunks );
+
+    return results;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // CHUNKED_READER_HPP
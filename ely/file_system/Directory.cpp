@@ -0,0 +1,336 @@
+#include "ely/file_system/Directory.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/// The record written by getdents64 for each entry.
+struct LinuxDirent64
+{
+    std::uint64_t d_ino;
+    std::int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[ 1 ];
+};
+
+
+ELY_ASSERT_MSG( DT_DIR == static_cast< int >( Directory::EntryType::Directory ) &&
+                DT_REG == static_cast< int >( Directory::EntryType::Regular ) &&
+                DT_LNK == static_cast< int >( Directory::EntryType::SymbolicLink ) &&
+                DT_SOCK == static_cast< int >( Directory::EntryType::Socket ),
+                "Directory::EntryType must match the d_type values" );
+
+
+} // namespace
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a \c Directory to list the entries of the directory \p path and try to open it.
+ *
+ * \param path        The path of the directory.
+ * \param bufferSize  The size of the buffer receiving the entries.
+ */
+Directory::Directory( const Path & path, std::size_t bufferSize )
+    : AbstractFile( path ),
+    myDescriptor( -1 ),
+    myError( 0 ),
+    myBufferSize( bufferSize ),
+    myBuffer()
+{
+    open();
+}
+
+/*!
+ * \brief Constructor
+ *
+ * Create a \c Directory to list the entries of the directory \p name in \p parent and try to open it.\n
+ * If \p parent is open, the directory is opened relatively to it with \e openat .
+ *
+ * \param parent      The directory containing the directory to open.
+ * \param name        The name of the directory to open.
+ * \param bufferSize  The size of the buffer receiving the entries.
+ */
+Directory::Directory( const Directory & parent, std::string_view name, std::size_t bufferSize )
+    : AbstractFile( Path::join( parent.getPath(), name ) ),
+    myDescriptor( -1 ),
+    myError( 0 ),
+    myBufferSize( bufferSize ),
+    myBuffer()
+{
+    if ( parent.isOpen() )
+    {
+        openAt( parent.getDescriptor(), name );
+    }
+    else
+    {
+        open();
+    }
+}
+
+/*!
+ * \brief Constructor
+ *
+ * Move constructor : Constructs the object with the contents of \p directory using the move semantics.\n
+ * \p directory is left closed.
+ *
+ * \param directory   The \c Directory object to move.
+ */
+Directory::Directory( Directory && directory ) noexcept
+    : AbstractFile( directory ),
+    myDescriptor( directory.myDescriptor ),
+    myError( directory.myError ),
+    myBufferSize( directory.myBufferSize ),
+    myBuffer( std::move( directory.myBuffer ) )
+{
+    directory.myDescriptor = -1;
+}
+
+/*!
+ * \brief Destructor
+ *
+ * Close the directory.
+ */
+Directory::~Directory()
+{
+    close();
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Open the directory.
+ *
+ * \return \c true if the directory is open, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool Directory::open()
+{
+    return openAt( AT_FDCWD, getPath() );
+}
+
+/*!
+ * \brief Close the directory.
+ */
+void Directory::close() noexcept
+{
+    if ( isOpen() )
+    {
+        ::close( myDescriptor );
+        myDescriptor = -1;
+    }
+}
+
+/*!
+ * \brief Get an iterator on the first entry.
+ *
+ * Restarts the listing from the beginning of the directory.
+ *
+ * \return An iterator on the first entry, equal to \c end() if the directory is empty or can't be read.
+ */
+Directory::Iterator Directory::begin()
+{
+    if ( ! isOpen() )
+    {
+        return end();
+    }
+
+    if ( ! myBuffer )
+    {
+        myBuffer.reset( new char[ myBufferSize ] );
+    }
+
+    ::lseek( myDescriptor, 0, SEEK_SET );
+
+    return Iterator( *this );
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Open the directory.
+ *
+ * \param parentDescriptor    The descriptor of the directory containing the directory, or \e AT_FDCWD .
+ * \param name                The path of the directory relatively to \p parentDescriptor .
+ *
+ * \return \c true if the directory is open, \c false otherwise.
+ */
+bool Directory::openAt( int parentDescriptor, std::string_view name )
+{
+    if ( ! isOpen() )
+    {
+        const std::string nameString( name );
+
+        myDescriptor = ::openat( parentDescriptor, nameString.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+        myError = isOpen() ? 0 : errno;
+    }
+
+    return isOpen();
+}
+
+/*!
+ * \brief Read a batch of entries in the buffer.
+ *
+ * \return The number of bytes read, \c 0 at the end of the directory or on failure.
+ *
+ * \sa getError()
+ */
+std::size_t Directory::read() noexcept
+{
+    const long size = ::syscall( SYS_getdents64, myDescriptor, myBuffer.get(), myBufferSize );
+
+    if ( 0 > size )
+    {
+        myError = errno;
+
+        return 0;
+    }
+
+    return static_cast< std::size_t >( size );
+}
+
+
+//
+// Entry
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create an empty entry.
+ */
+Directory::Entry::Entry() noexcept
+    : myName(),
+    myType( EntryType::Unknown ),
+    myInode( 0 )
+{}
+
+
+//
+// Iterator
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create an end iterator.
+ */
+Directory::Iterator::Iterator() noexcept
+    : myDirectory( nullptr ),
+    myOffset( 0 ),
+    mySize( 0 ),
+    myEntry()
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * Create an iterator on the next entry of \p directory .
+ *
+ * \param directory   The open directory to iterate over.
+ */
+Directory::Iterator::Iterator( Directory & directory ) noexcept
+    : myDirectory( &directory ),
+    myOffset( 0 ),
+    mySize( 0 ),
+    myEntry()
+{
+    readEntry();
+}
+
+/*!
+ * \brief Move to the next entry.
+ *
+ * \return A reference on the current object.
+ */
+Directory::Iterator & Directory::Iterator::operator ++() noexcept
+{
+    const LinuxDirent64 * record = reinterpret_cast< const LinuxDirent64 * >( myDirectory->myBuffer.get() + myOffset );
+
+    myOffset += record->d_reclen;
+    readEntry();
+
+    return *this;
+}
+
+/*!
+ * \brief Read the entry at the current offset.
+ *
+ * Reads the next batch at the end of the buffer and becomes an end iterator at the end of the directory,
+ * releasing the buffer until the next iteration.
+ */
+void Directory::Iterator::readEntry() noexcept
+{
+    for ( ; ; )
+    {
+        if ( myOffset >= mySize )
+        {
+            myOffset = 0;
+            mySize = myDirectory->read();
+
+            if ( 0 == mySize )
+            {
+                myDirectory->myBuffer.reset();
+                *this = Iterator();
+
+                return;
+            }
+        }
+
+        const LinuxDirent64 * record = reinterpret_cast< const LinuxDirent64 * >( myDirectory->myBuffer.get() + myOffset );
+        const std::size_t nameCapacity = record->d_reclen - offsetof( LinuxDirent64, d_name );
+        const std::string_view name( record->d_name, ::strnlen( record->d_name, nameCapacity ) );
+
+        if ( "." != name && ".." != name )
+        {
+            myEntry.myName = name;
+            myEntry.myType = static_cast< EntryType >( record->d_type );
+            myEntry.myInode = record->d_ino;
+
+            return;
+        }
+
+        myOffset += record->d_reclen;
+    }
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
@@ -0,0 +1,324 @@
+/*!
+ * \file Directory.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for list the entries of a directory.
+ */
+#ifndef DIRECTORY_HPP
+#define DIRECTORY_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/AbstractFile.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The Directory class
+ *
+ * Represents a directory and lists its entries.\n\n
+ *
+ * The entries are read by large batches with the \e getdents64 system call in a buffer
+ * owned by the directory and reused by every iteration : an entry is a view on this
+ * buffer, its name and type are available without allocation nor \e stat call.\n
+ * The buffer is only allocated while an iteration is running.\n
+ * The entries \e . and \e .. are skipped.\n\n
+ *
+ * A directory can be opened relatively to an opened parent with \e openat , without
+ * resolving the path of the parent again.\n
+ * Only available on Linux.
+ */
+class Directory : public AbstractFile
+{
+public:
+    class Entry;
+    class Iterator;
+
+    /// The type of an entry, as given by the file system.
+    enum class EntryType : unsigned char
+    {
+        Unknown = 0,
+        Fifo = 1,
+        CharacterDevice = 2,
+        Directory = 4,
+        BlockDevice = 6,
+        Regular = 8,
+        SymbolicLink = 10,
+        Socket = 12
+    };
+
+
+    static constexpr std::size_t defaultBufferSize() noexcept;
+
+
+    explicit Directory( const Path & path, std::size_t bufferSize = defaultBufferSize() );
+    Directory( const Directory & parent, std::string_view name, std::size_t bufferSize = defaultBufferSize() );
+    Directory( Directory && directory ) noexcept;
+    ~Directory();
+
+    Directory( const Directory & ) = delete;
+    Directory & operator =( const Directory & ) = delete;
+
+
+    bool open();
+    void close() noexcept;
+    bool isOpen() const noexcept;
+
+    int getDescriptor() const noexcept;
+    int getError() const noexcept;
+
+
+    Iterator begin();
+    Iterator end() noexcept;
+
+private:
+    bool openAt( int parentDescriptor, std::string_view name );
+    std::size_t read() noexcept;
+
+
+    int myDescriptor;
+    int myError;
+    std::size_t myBufferSize;
+    std::unique_ptr< char[] > myBuffer;
+};
+
+
+/*!
+ * \brief The Directory::Entry class
+ *
+ * An entry of a directory, valid until the iterator giving it is incremented.
+ * Its name is null terminated so it can be given to the system calls relative to the directory.
+ */
+class Directory::Entry
+{
+public:
+    Entry() noexcept;
+
+
+    std::string_view getName() const noexcept;
+    EntryType getType() const noexcept;
+    std::uint64_t getInode() const noexcept;
+
+    bool isDirectory() const noexcept;
+
+private:
+    friend class Iterator;
+
+
+    std::string_view myName;
+    EntryType myType;
+    std::uint64_t myInode;
+};
+
+
+/*!
+ * \brief The Directory::Iterator class
+ *
+ * An input iterator over the entries of a directory.\n
+ * Only one iteration at a time is allowed since the entries share the buffer of the directory.
+ */
+class Directory::Iterator
+{
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef Entry value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Entry * pointer;
+    typedef const Entry & reference;
+
+
+    Iterator() noexcept;
+    explicit Iterator( Directory & directory ) noexcept;
+
+
+    reference operator *() const noexcept;
+    pointer operator ->() const noexcept;
+
+    Iterator & operator ++() noexcept;
+
+    bool operator ==( const Iterator & iterator ) const noexcept;
+    bool operator !=( const Iterator & iterator ) const noexcept;
+
+private:
+    void readEntry() noexcept;
+
+
+    Directory * myDirectory;
+    std::size_t myOffset;
+    std::size_t mySize;
+    Entry myEntry;
+};
+
+
+//
+// Directory inline functions
+//
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default size of the buffer receiving the entries.
+ */
+constexpr std::size_t Directory::defaultBufferSize() noexcept
+{
+    return 128 * 1024;
+}
+
+/*!
+ * \brief Check if the directory is open.
+ *
+ * \return \c true if the directory is open, \c false otherwise.
+ */
+inline bool Directory::isOpen() const noexcept
+{
+    return 0 <= myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The file descriptor of the directory, negative if it's not open.
+ */
+inline int Directory::getDescriptor() const noexcept
+{
+    return myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The \e errno value of the last failure, \c 0 if there was none.
+ */
+inline int Directory::getError() const noexcept
+{
+    return myError;
+}
+
+/*!
+ * \brief Get an iterator after the last entry.
+ *
+ * \return The end iterator.
+ */
+inline Directory::Iterator Directory::end() noexcept
+{
+    return Iterator();
+}
+
+
+//
+// Entry inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The name of the entry.
+ */
+inline std::string_view Directory::Entry::getName() const noexcept
+{
+    return myName;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The type of the entry, \c EntryType::Unknown if the file system doesn't give it.
+ */
+inline Directory::EntryType Directory::Entry::getType() const noexcept
+{
+    return myType;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The inode number of the entry.
+ */
+inline std::uint64_t Directory::Entry::getInode() const noexcept
+{
+    return myInode;
+}
+
+/*!
+ * \brief Check if the entry is a directory.
+ *
+ * \return \c true if the entry is a directory, \c false otherwise or if its type is unknown.
+ */
+inline bool Directory::Entry::isDirectory() const noexcept
+{
+    return EntryType::Directory == myType;
+}
+
+
+//
+// Iterator inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The current entry.
+ */
+inline Directory::Iterator::reference Directory::Iterator::operator *() const noexcept
+{
+    return myEntry;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return A pointer on the current entry.
+ */
+inline Directory::Iterator::pointer Directory::Iterator::operator ->() const noexcept
+{
+    return &myEntry;
+}
+
+/*!
+ * \brief Operator <em>equal to</em>
+ *
+ * \param iterator    An iterator on the same directory.
+ *
+ * \return \c true if both iterators are at the end of the directory, or on the same entry.
+ */
+inline bool Directory::Iterator::operator ==( const Iterator & iterator ) const noexcept
+{
+    return myDirectory == iterator.myDirectory && myOffset == iterator.myOffset;
+}
+
+/*!
+ * \brief Operator <em>not equal to</em>
+ *
+ * \param iterator    An iterator on the same directory.
+ *
+ * \return \c true if the iterators are on different entries, \c false otherwise.
+ */
+inline bool Directory::Iterator::operator !=( const Iterator & iterator ) const noexcept
+{
+    return ! ( *this == iterator );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
+
+#endif // DIRECTORY_HPP
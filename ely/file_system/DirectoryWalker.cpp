@@ -0,0 +1,338 @@
+#include "ely/file_system/DirectoryWalker.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <utility>
+
+
+#include <fcntl.h>
+
+
+#include "ely/file_system/PathView.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/*!
+ * \brief Get the type of an entry from its status.
+ *
+ * \param status  The status of the entry.
+ *
+ * \return The type of the entry.
+ */
+Directory::EntryType toEntryType( const struct stat & status ) noexcept
+{
+    // The types of the directory entries are the file types of the mode shifted
+    return static_cast< Directory::EntryType >( ( status.st_mode & S_IFMT ) >> 12 );
+}
+
+
+/// Resets the callback and the exception of a walk when it ends, even by an exception.
+class WalkGuard
+{
+public:
+    WalkGuard( DirectoryWalker::Callback & callback, std::exception_ptr & exception ) noexcept
+        : myCallback( callback ),
+        myException( exception )
+    {}
+
+    ~WalkGuard()
+    {
+        myCallback = nullptr;
+        myException = nullptr;
+    }
+
+    WalkGuard( const WalkGuard & ) = delete;
+    WalkGuard & operator =( const WalkGuard & ) = delete;
+
+private:
+    DirectoryWalker::Callback & myCallback;
+    std::exception_ptr & myException;
+};
+
+
+} // namespace
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a walker reporting every entry, without limit of depth.
+ *
+ * \param pool    The pool running the walks.
+ */
+DirectoryWalker::DirectoryWalker( utilities::WorkStealingThreadPool & pool )
+    : myPool( pool ),
+    myMaximumDepth( std::numeric_limits< std::size_t >::max() ),
+    myExtensions(),
+    myTypes( std::numeric_limits< std::uint32_t >::max() ),
+    myIsStatusRequired( false ),
+    myCallback(),
+    myNumberOfErrors( 0 ),
+    myExceptionMutex(),
+    myException()
+{}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Mutator
+ *
+ * The directories at the maximum depth aren't walked through.
+ *
+ * \param maximumDepth    The maximum depth of the reported entries, \c 1 for the entries of the root only.
+ */
+void DirectoryWalker::setMaximumDepth( std::size_t maximumDepth ) noexcept
+{
+    myMaximumDepth = maximumDepth;
+}
+
+/*!
+ * \brief Mutator
+ *
+ * Only the entries with one of the \p extensions are reported, as given by \c FilePath::extractExtension() .
+ *
+ * \param extensions  The accepted extensions, without separator, every extension if empty.
+ */
+void DirectoryWalker::setExtensions( std::vector< std::string > extensions )
+{
+    myExtensions = std::move( extensions );
+}
+
+/*!
+ * \brief Mutator
+ *
+ * Only the entries of one of the \p types are reported.
+ *
+ * \param types   The accepted types, every type if empty.
+ */
+void DirectoryWalker::setTypes( std::initializer_list< Directory::EntryType > types ) noexcept
+{
+    myTypes = ( 0 == types.size() ) ? std::numeric_limits< std::uint32_t >::max() : 0;
+
+    for ( Directory::EntryType type : types )
+    {
+        myTypes |= std::uint32_t( 1 ) << static_cast< unsigned >( type );
+    }
+}
+
+/*!
+ * \brief Mutator
+ *
+ * \param isStatusRequired    \c true to read the status of every reported entry with \e fstatat .
+ *
+ * \sa Entry::getStatus()
+ */
+void DirectoryWalker::setStatusRequired( bool isStatusRequired ) noexcept
+{
+    myIsStatusRequired = isStatusRequired;
+}
+
+/*!
+ * \brief Walk through the tree of \p root .
+ *
+ * Returns when the whole tree is walked through. The callback is called concurrently by
+ * the threads of the pool and must not submit work waiting for the walk.\n
+ * Must not be called by a task of the pool.
+ *
+ * \param root        The directory to walk through, not reported.
+ * \param callback    The function receiving the entries.
+ *
+ * \exception The first exception thrown by the callback, rethrown once the whole tree
+ * is walked through : the other entries are still reported.
+ */
+void DirectoryWalker::walk( const Path & root, Callback callback )
+{
+    WalkGuard guard( myCallback, myException );
+
+    myCallback = std::move( callback );
+    myNumberOfErrors = 0;
+
+    myPool.submit( [ this, root ]
+    {
+        visit( std::make_shared< Directory >( root ), 0 );
+    } );
+
+    myPool.wait();
+
+    if ( myException )
+    {
+        std::rethrow_exception( myException );
+    }
+}
+
+/*!
+ * \brief Walk through the tree of \p root and push the paths of its entries in \p queue .
+ *
+ * When \p queue is full the threads of the pool wait for the consumers,
+ * which must run in other threads.
+ *
+ * \param root    The directory to walk through, not reported.
+ * \param queue   The queue receiving the paths of the entries.
+ *
+ * \sa walk( const Path &, Callback )
+ */
+void DirectoryWalker::walk( const Path & root, utilities::MpmcQueue< Path > & queue )
+{
+    walk( root, [ &queue ]( const Entry & entry )
+    {
+        Path path( std::string( entry.getPath() ) );
+
+        while ( ! queue.tryPush( std::move( path ) ) )
+        {
+            std::this_thread::yield();
+        }
+    } );
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief List a directory, report its entries and submit its subdirectories.
+ *
+ * \param directory   The directory to list.
+ * \param depth       The depth of \p directory .
+ */
+void DirectoryWalker::visit( const std::shared_ptr< Directory > & directory, std::size_t depth )
+{
+    if ( ! directory->isOpen() )
+    {
+        ++myNumberOfErrors;
+
+        return;
+    }
+
+    const std::size_t entryDepth = depth + 1;
+    const int descriptor = directory->getDescriptor();
+    std::string entryPath;
+    struct stat status;
+
+    for ( const Directory::Entry & directoryEntry : *directory )
+    {
+        const std::string_view name = directoryEntry.getName();
+        Directory::EntryType type = directoryEntry.getType();
+        bool hasStatus = false;
+
+        if ( Directory::EntryType::Unknown == type )
+        {
+            hasStatus = ( 0 == ::fstatat( descriptor, name.data(), &status, AT_SYMLINK_NOFOLLOW ) );
+            type = hasStatus ? toEntryType( status ) : type;
+        }
+
+        if ( accepts( name, type ) )
+        {
+            if ( myIsStatusRequired && ! hasStatus )
+            {
+                hasStatus = ( 0 == ::fstatat( descriptor, name.data(), &status, AT_SYMLINK_NOFOLLOW ) );
+            }
+
+            Entry entry;
+
+            entry.myPath = Path::joinTo( entryPath, directory->getPath(), name );
+            entry.myName = name;
+            entry.myType = type;
+            entry.myInode = directoryEntry.getInode();
+            entry.myDepth = entryDepth;
+            entry.myDirectoryDescriptor = descriptor;
+            entry.myStatus = ( myIsStatusRequired && hasStatus ) ? &status : nullptr;
+
+            report( entry );
+        }
+
+        if ( Directory::EntryType::Directory == type && entryDepth < myMaximumDepth )
+        {
+            // The task keeps the parent open until the subdirectory is opened relatively to it
+            myPool.submit( [ this, parent = directory, name = std::string( name ), entryDepth ]() mutable
+            {
+                std::shared_ptr< Directory > subdirectory = std::make_shared< Directory >( *parent, name );
+
+                parent.reset();
+                visit( subdirectory, entryDepth );
+            } );
+        }
+    }
+
+    if ( 0 != directory->getError() )
+    {
+        ++myNumberOfErrors;
+    }
+}
+
+/*!
+ * \brief Report an entry to the callback.
+ *
+ * Keeps the first exception thrown by the callback, so the walk goes on with the
+ * next entries and the subdirectories.
+ *
+ * \param entry   The entry to report.
+ */
+void DirectoryWalker::report( const Entry & entry ) noexcept
+{
+    try
+    {
+        myCallback( entry );
+    }
+    catch ( ... )
+    {
+        std::lock_guard< std::mutex > lock( myExceptionMutex );
+
+        if ( ! myException )
+        {
+            myException = std::current_exception();
+        }
+    }
+}
+
+/*!
+ * \brief Check if an entry passes the filters.
+ *
+ * \param name    The name of the entry.
+ * \param type    The type of the entry.
+ *
+ * \return \c true if the entry has to be reported, \c false otherwise.
+ */
+bool DirectoryWalker::accepts( std::string_view name, Directory::EntryType type ) const noexcept
+{
+    if ( 0 == ( myTypes & ( std::uint32_t( 1 ) << static_cast< unsigned >( type ) ) ) )
+    {
+        return false;
+    }
+
+    if ( myExtensions.empty() )
+    {
+        return true;
+    }
+
+    const std::string_view extension = PathView( name ).extension();
+
+    return std::any_of( myExtensions.begin(), myExtensions.end(),
+                        [ extension ]( const std::string & accepted ) { return extension == accepted; } );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
@@ -0,0 +1,255 @@
+/*!
+ * \file DirectoryWalker.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for walk through a tree of directories with a pool of threads.
+ */
+#ifndef DIRECTORY_WALKER_HPP
+#define DIRECTORY_WALKER_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/Directory.hpp"
+#include "ely/file_system/Path.hpp"
+#include "ely/utilities/MpmcQueue.hpp"
+#include "ely/utilities/WorkStealingThreadPool.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <sys/stat.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The DirectoryWalker class
+ *
+ * Walks recursively through a tree of directories and reports its entries.\n\n
+ *
+ * Each directory is listed by a task of a \c WorkStealingThreadPool and its subdirectories
+ * are submitted as new tasks, so the threads of the pool share the tree.\n
+ * A subdirectory is opened with \e openat relatively to its parent and the type of an entry
+ * unknown to the file system is read with \e fstatat , so paths are never resolved again.\n
+ * The filters (depth, extension and type) are evaluated on the name and type given by the
+ * directory before any allocation : a rejected entry costs nothing more than its listing.\n
+ * The filters select the reported entries, every subdirectory within the maximum depth is
+ * walked through. Symbolic links are reported but never followed.\n\n
+ *
+ * The entries are reported to a callback called concurrently by the threads of the pool,
+ * or pushed in a bounded \c MpmcQueue consumed by other threads.
+ */
+class DirectoryWalker final
+{
+public:
+    class Entry;
+
+    /// The function receiving the entries.
+    typedef std::function< void( const Entry & ) > Callback;
+
+
+    explicit DirectoryWalker( utilities::WorkStealingThreadPool & pool );
+
+    DirectoryWalker( const DirectoryWalker & ) = delete;
+    DirectoryWalker & operator =( const DirectoryWalker & ) = delete;
+
+
+    std::size_t getMaximumDepth() const noexcept;
+    void setMaximumDepth( std::size_t maximumDepth ) noexcept;
+    void setExtensions( std::vector< std::string > extensions );
+    void setTypes( std::initializer_list< Directory::EntryType > types ) noexcept;
+    void setStatusRequired( bool isStatusRequired ) noexcept;
+
+    std::size_t getNumberOfErrors() const noexcept;
+
+
+    void walk( const Path & root, Callback callback );
+    void walk( const Path & root, utilities::MpmcQueue< Path > & queue );
+
+private:
+    void visit( const std::shared_ptr< Directory > & directory, std::size_t depth );
+    void report( const Entry & entry ) noexcept;
+    bool accepts( std::string_view name, Directory::EntryType type ) const noexcept;
+
+
+    utilities::WorkStealingThreadPool & myPool;
+    std::size_t myMaximumDepth;
+    std::vector< std::string > myExtensions;
+    /// The accepted types, a bit for each value of \c Directory::EntryType .
+    std::uint32_t myTypes;
+    bool myIsStatusRequired;
+    Callback myCallback;
+    std::atomic< std::size_t > myNumberOfErrors;
+    std::mutex myExceptionMutex;
+    /// The first exception thrown by the callback during the walk.
+    std::exception_ptr myException;
+};
+
+
+/*!
+ * \brief The DirectoryWalker::Entry class
+ *
+ * An entry reported by a \c DirectoryWalker , valid during the call of the callback.
+ */
+class DirectoryWalker::Entry
+{
+public:
+    std::string_view getPath() const noexcept;
+    std::string_view getName() const noexcept;
+    Directory::EntryType getType() const noexcept;
+    std::uint64_t getInode() const noexcept;
+    std::size_t getDepth() const noexcept;
+    int getDirectoryDescriptor() const noexcept;
+    const struct stat * getStatus() const noexcept;
+
+private:
+    friend class DirectoryWalker;
+
+
+    Entry() noexcept = default;
+
+
+    std::string_view myPath;
+    std::string_view myName;
+    Directory::EntryType myType;
+    std::uint64_t myInode;
+    std::size_t myDepth;
+    int myDirectoryDescriptor;
+    const struct stat * myStatus;
+};
+
+
+//
+// DirectoryWalker inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * The root has the depth \c 0 and its entries the depth \c 1 .
+ *
+ * \return The maximum depth of the reported entries.
+ */
+inline std::size_t DirectoryWalker::getMaximumDepth() const noexcept
+{
+    return myMaximumDepth;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * Counts the directories which couldn't be opened or read during the last walk.
+ *
+ * \return The number of errors.
+ */
+inline std::size_t DirectoryWalker::getNumberOfErrors() const noexcept
+{
+    return myNumberOfErrors;
+}
+
+
+//
+// DirectoryWalker::Entry inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The path of the entry, starting with the path of the root.
+ */
+inline std::string_view DirectoryWalker::Entry::getPath() const noexcept
+{
+    return myPath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The name of the entry, null terminated.
+ */
+inline std::string_view DirectoryWalker::Entry::getName() const noexcept
+{
+    return myName;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The type of the entry, read with \e fstatat if the file system doesn't give it.
+ */
+inline Directory::EntryType DirectoryWalker::Entry::getType() const noexcept
+{
+    return myType;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The inode number of the entry.
+ */
+inline std::uint64_t DirectoryWalker::Entry::getInode() const noexcept
+{
+    return myInode;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The depth of the entry, \c 1 for the entries of the root.
+ */
+inline std::size_t DirectoryWalker::Entry::getDepth() const noexcept
+{
+    return myDepth;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The descriptor of the directory containing the entry, to use with the \e *at system calls.
+ */
+inline int DirectoryWalker::Entry::getDirectoryDescriptor() const noexcept
+{
+    return myDirectoryDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The status of the entry if required by the walker and available, \c nullptr otherwise.
+ *
+ * \sa DirectoryWalker::setStatusRequired()
+ */
+inline const struct stat * DirectoryWalker::Entry::getStatus() const noexcept
+{
+    return myStatus;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
+
+
+#endif // DIRECTORY_WALKER_HPP
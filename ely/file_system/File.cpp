@@ -1,15 +1,267 @@
 #include "ely/file_system/File.hpp"
 
+#include <cerrno>
 #include <cstdio>
+#include <utility>
 
 #include "ely/config.hpp"
 
+#if defined ( ELY_POSIX_API )
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+
+#   include "ely/file_system/operations.hpp"
+#endif
+
 using std::string;
 
 namespace ely
 {
 namespace file_system
 {
+namespace
+{
+
+
+#if defined ( ELY_POSIX_API )
+
+/// The size of the buffer of the stream.
+constexpr std::size_t streamBufferSize = 4096;
+
+#else
+
+/*!
+ * \brief Get the mode of a stream corresponding to an open mode.
+ *
+ * \param mode    The open mode.
+ *
+ * \return The mode of the stream.
+ */
+std::ios_base::openmode toStreamMode( OpenMode mode )
+{
+    std::ios_base::openmode streamMode = std::ios_base::openmode();
+
+    if ( hasFlag( mode, OpenMode::Read ) )
+    {
+        streamMode |= std::ios_base::in;
+    }
+
+    if ( hasFlag( mode, OpenMode::Write ) )
+    {
+        streamMode |= std::ios_base::out;
+    }
+
+    if ( hasFlag( mode, OpenMode::Truncate ) )
+    {
+        streamMode |= std::ios_base::out | std::ios_base::trunc;
+    }
+
+    if ( hasFlag( mode, OpenMode::Append ) )
+    {
+        streamMode |= std::ios_base::out | std::ios_base::app;
+    }
+
+    return streamMode;
+}
+
+#endif // ELY_POSIX_API
+
+
+} // namespace
+
+
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief A stream buffer on the descriptor of a \c File .
+ *
+ * The data is read and written at the current position of the descriptor,
+ * the get area and the put area are never used at the same time.
+ */
+class File::DescriptorStreambuf : public std::streambuf
+{
+public:
+    explicit DescriptorStreambuf( int descriptor );
+
+protected:
+    virtual int_type underflow() ELY_OVERRIDE;
+    virtual int_type overflow( int_type character ) ELY_OVERRIDE;
+    virtual int sync() ELY_OVERRIDE;
+    virtual pos_type seekoff( off_type offset, std::ios_base::seekdir direction,
+                              std::ios_base::openmode mode ) ELY_OVERRIDE;
+    virtual pos_type seekpos( pos_type position, std::ios_base::openmode mode ) ELY_OVERRIDE;
+
+private:
+    bool writePending();
+
+
+    int myDescriptor;
+    char myBuffer[ streamBufferSize ];
+};
+
+
+File::DescriptorStreambuf::DescriptorStreambuf( int descriptor )
+    : myDescriptor( descriptor )
+{}
+
+
+/*!
+ * \brief Read the next data of the file in the get area.
+ *
+ * \return The next character, \c traits_type::eof() at the end of the file or on failure.
+ */
+File::DescriptorStreambuf::int_type File::DescriptorStreambuf::underflow()
+{
+    if ( 0 != sync() )
+    {
+        return traits_type::eof();
+    }
+
+    ssize_t result;
+
+    do
+    {
+        result = ::read( myDescriptor, myBuffer, sizeof( myBuffer ) );
+    }
+    while ( 0 > result && EINTR == errno );
+
+    if ( 0 >= result )
+    {
+        return traits_type::eof();
+    }
+
+    setg( myBuffer, myBuffer, myBuffer + result );
+
+    return traits_type::to_int_type( *gptr() );
+}
+
+/*!
+ * \brief Write the put area in the file to make room for \p character .
+ *
+ * \param character The character which didn't fit in the put area.
+ *
+ * \return \p character , \c traits_type::eof() on failure.
+ */
+File::DescriptorStreambuf::int_type File::DescriptorStreambuf::overflow( int_type character )
+{
+    if ( nullptr == pbase() )
+    {
+        // The read ahead data is dropped before writing at the position of the reader
+        if ( 0 != sync() )
+        {
+            return traits_type::eof();
+        }
+    }
+    else if ( ! writePending() )
+    {
+        return traits_type::eof();
+    }
+
+    setp( myBuffer, myBuffer + sizeof( myBuffer ) );
+
+    if ( traits_type::eq_int_type( character, traits_type::eof() ) )
+    {
+        return traits_type::not_eof( character );
+    }
+
+    *pptr() = traits_type::to_char_type( character );
+    pbump( 1 );
+
+    return character;
+}
+
+/*!
+ * \brief Synchronize the descriptor with the stream.
+ *
+ * Write the pending data, or move the descriptor back before the data read ahead.
+ *
+ * \return \c 0 on success, \c -1 otherwise.
+ */
+int File::DescriptorStreambuf::sync()
+{
+    if ( nullptr != pbase() )
+    {
+        const bool isWritten = writePending();
+
+        setp( nullptr, nullptr );
+
+        return isWritten ? 0 : -1;
+    }
+
+    if ( gptr() < egptr() )
+    {
+        const off_t unread = static_cast< off_t >( egptr() - gptr() );
+
+        setg( nullptr, nullptr, nullptr );
+
+        return ( -1 != ::lseek( myDescriptor, -unread, SEEK_CUR ) ) ? 0 : -1;
+    }
+
+    setg( nullptr, nullptr, nullptr );
+
+    return 0;
+}
+
+File::DescriptorStreambuf::pos_type File::DescriptorStreambuf::seekoff( off_type offset,
+                                                                        std::ios_base::seekdir direction,
+                                                                        std::ios_base::openmode )
+{
+    if ( 0 != sync() )
+    {
+        return pos_type( off_type( -1 ) );
+    }
+
+    int whence = SEEK_SET;
+
+    if ( std::ios_base::cur == direction )
+    {
+        whence = SEEK_CUR;
+    }
+    else if ( std::ios_base::end == direction )
+    {
+        whence = SEEK_END;
+    }
+
+    return pos_type( static_cast< off_type >( ::lseek( myDescriptor, static_cast< off_t >( offset ), whence ) ) );
+}
+
+File::DescriptorStreambuf::pos_type File::DescriptorStreambuf::seekpos( pos_type position,
+                                                                        std::ios_base::openmode mode )
+{
+    return seekoff( off_type( position ), std::ios_base::beg, mode );
+}
+
+
+/*!
+ * \brief Write the data of the put area in the file.
+ *
+ * \return \c true if every byte was written, \c false otherwise.
+ */
+bool File::DescriptorStreambuf::writePending()
+{
+    const char * data = pbase();
+
+    while ( data < pptr() )
+    {
+        const ssize_t result = ::write( myDescriptor, data, static_cast< std::size_t >( pptr() - data ) );
+
+        if ( 0 < result )
+        {
+            data += result;
+        }
+        else if ( 0 == result || EINTR != errno )
+        {
+            return false;
+        }
+    }
+
+    setp( pbase(), epptr() );
+
+    return true;
+}
+
+#endif // ELY_POSIX_API
 
 
 //
@@ -21,11 +273,16 @@ namespace file_system
  * Create a \c File to access the file representing by \p filePathString and try to open it.
  *
  * \param filePathString  A string representing the path to the file to manage.
+ * \param mode            How the file is opened.
  */
-File::File( const string & filePathString )
+File::File( const string & filePathString, OpenMode mode )
     : myFilePath( filePathString ),
-    myStream( ELY_NULLPTR ),
-    myIsOpen( false )
+    myOpenMode( mode ),
+#if defined ( ELY_POSIX_API )
+    myDescriptor( -1 ),
+#endif
+    myError( 0 ),
+    myStream( ELY_NULLPTR )
 {
     open();
 }
@@ -36,11 +293,16 @@ File::File( const string & filePathString )
  * Create a \c File to access the file representing by \p filePath and try to open it.
  *
  * \param filePath  A \c FilePath object representing the path to the file to manage.
+ * \param mode      How the file is opened.
  */
-File::File( const FilePath & filePath )
+File::File( const FilePath & filePath, OpenMode mode )
     : myFilePath( filePath ),
-    myStream( ELY_NULLPTR ),
-    myIsOpen( false )
+    myOpenMode( mode ),
+#if defined ( ELY_POSIX_API )
+    myDescriptor( -1 ),
+#endif
+    myError( 0 ),
+    myStream( ELY_NULLPTR )
 {
     open();
 }
@@ -55,16 +317,33 @@ File::File( const FilePath & filePath )
  */
 File::File( File && file )
     : myFilePath( std::move( file.myFilePath ) ),
-    myStream( std::move( file.myStream ) ),
-    myIsOpen( std::move( file.myIsOpen ) )
+    myOpenMode( file.myOpenMode ),
+#if defined ( ELY_POSIX_API )
+    myDescriptor( std::exchange( file.myDescriptor, -1 ) ),
+#endif
+    myError( file.myError ),
+#if defined ( ELY_POSIX_API )
+    myStreamBuffer( std::move( file.myStreamBuffer ) ),
+#endif
+    myStream( std::move( file.myStream ) )
 {}
 
 
 File & File::operator =( File && file )
 {
-    myFilePath = std::move( file.myFilePath );
-    myStream = std::move( file.myStream );
-    myIsOpen = std::move( file.myIsOpen );
+    if ( this != &file )
+    {
+        close();
+
+        myFilePath = std::move( file.myFilePath );
+        myOpenMode = file.myOpenMode;
+#if defined ( ELY_POSIX_API )
+        myDescriptor = std::exchange( file.myDescriptor, -1 );
+        myStreamBuffer = std::move( file.myStreamBuffer );
+#endif
+        myError = file.myError;
+        myStream = std::move( file.myStream );
+    }
 
     return *this;
 }
@@ -73,8 +352,13 @@ File & File::operator =( File && file )
 void File::swap( File & file )
 {
     std::swap( myFilePath, file.myFilePath );
+    std::swap( myOpenMode, file.myOpenMode );
+#if defined ( ELY_POSIX_API )
+    std::swap( myDescriptor, file.myDescriptor );
+    myStreamBuffer.swap( file.myStreamBuffer );
+#endif
+    std::swap( myError, file.myError );
     myStream.swap( file.myStream );
-    std::swap( myIsOpen, file.myIsOpen );
 }
 
 
@@ -87,56 +371,354 @@ File::~File()
 //
 // Public functions
 //
+/*!
+ * \brief Open the file
+ *
+ * Open the file with its open mode, does nothing if it's already open.
+ *
+ * \return \c true if the file is open, \c false otherwise.
+ *
+ * \sa getError()
+ */
 bool File::open()
 {
     if ( ! isOpen() )
     {
-        myStream.reset( new FileStream( FilePath::toSystemSeparator( myFilePath.toString() ),
-                                        std::ios_base::in | std::ios_base::out | std::ios_base::app ) );
+        const string pathString( FilePath::toSystemSeparator( std::string( myFilePath.toString() ) ) );
 
-        if ( false == ! getStream() )
+#if defined ( ELY_POSIX_API )
+        do
         {
-            myIsOpen = true;
+            myDescriptor = ::open( pathString.c_str(), toOpenFlags( myOpenMode ), 0666 );
         }
+        while ( ! isOpen() && EINTR == errno );
+#else
+        myStream.reset( new FileStream( pathString, toStreamMode( myOpenMode ) ) );
+
+        // Reading and writing without truncating nor appending doesn't create the file
+        if ( ! isOpen() && hasFlag( myOpenMode, OpenMode::Create ) )
+        {
+            FileStream( pathString, std::ios_base::out | std::ios_base::app ).close();
+            myStream->open( pathString, toStreamMode( myOpenMode ) );
+        }
+#endif
+
+        myError = isOpen() ? 0 : errno;
     }
 
-    return myIsOpen;
+    return isOpen();
 }
 
 bool File::open( const std::string & filePathString )
 {
-    open( FilePath( filePathString ) );
-
-    return myIsOpen;
+    return open( FilePath( filePathString ) );
 }
 
 bool File::open( const FilePath & filePath )
 {
-    if ( filePath == myFilePath )
-    {
-        open();
-    }
-    else
+    return open( filePath, myOpenMode );
+}
+
+/*!
+ * \brief Open a file
+ *
+ * Close the current file if it's another one or if \p mode is different, then open \p filePath .
+ *
+ * \param filePath  A \c FilePath object representing the path to the file to manage.
+ * \param mode      How the file is opened.
+ *
+ * \return \c true if the file is open, \c false otherwise.
+ */
+bool File::open( const FilePath & filePath, OpenMode mode )
+{
+    if ( ! ( filePath == myFilePath ) || mode != myOpenMode )
     {
         close();
 
         myFilePath = filePath;
-
-        open();
+        myOpenMode = mode;
     }
 
-    return myIsOpen;
+    return open();
 }
 
 
 void File::close()
 {
+#if defined ( ELY_POSIX_API )
+    syncStream();
+
+    myStream.reset();
+    myStreamBuffer.reset();
+
     if ( isOpen() )
     {
-        getStream().close();
+        ::close( myDescriptor );
+
+        myDescriptor = -1;
+    }
+#else
+    if ( myStream )
+    {
+        myStream->close();
+        myStream.reset();
+    }
+#endif
+}
+
+
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief Read from the current position
+ *
+ * Read until \p size bytes are read or the end of the file is reached.
+ *
+ * \param buffer  Receives the data.
+ * \param size    The number of bytes to read.
+ *
+ * \return The number of bytes read, less than \p size at the end of the file or on failure.
+ *
+ * \sa getError()
+ */
+std::size_t File::read( void * buffer, std::size_t size )
+{
+    std::size_t total = 0;
+
+    syncStream();
+
+    myError = 0;
+
+    while ( total < size )
+    {
+        const ssize_t result = ::read( myDescriptor, static_cast< char * >( buffer ) + total, size - total );
 
-        myIsOpen = false;
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            break;
+        }
+        else if ( EINTR != errno )
+        {
+            myError = errno;
+            break;
+        }
     }
+
+    return total;
+}
+
+/*!
+ * \brief Read at an offset
+ *
+ * Read until \p size bytes are read or the end of the file is reached, without moving the current position.
+ *
+ * \param offset  The offset of the data in the file.
+ * \param buffer  Receives the data.
+ * \param size    The number of bytes to read.
+ *
+ * \return The number of bytes read, less than \p size at the end of the file or on failure.
+ *
+ * \sa getError()
+ */
+std::size_t File::readAt( std::uint64_t offset, void * buffer, std::size_t size )
+{
+    std::size_t total = 0;
+
+    syncStream();
+
+    myError = 0;
+
+    while ( total < size )
+    {
+        const ssize_t result = ::pread( myDescriptor, static_cast< char * >( buffer ) + total, size - total,
+                                        static_cast< off_t >( offset + total ) );
+
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            break;
+        }
+        else if ( EINTR != errno )
+        {
+            myError = errno;
+            break;
+        }
+    }
+
+    return total;
+}
+
+/*!
+ * \brief Write at the current position
+ *
+ * \param buffer  The data to write.
+ * \param size    The number of bytes to write.
+ *
+ * \return \c true if every byte was written, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool File::write( const void * buffer, std::size_t size )
+{
+    std::size_t total = 0;
+
+    syncStream();
+
+    myError = 0;
+
+    while ( total < size )
+    {
+        const ssize_t result = ::write( myDescriptor, static_cast< const char * >( buffer ) + total, size - total );
+
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            // Nothing written without an error, retrying would loop forever
+            myError = EIO;
+
+            return false;
+        }
+        else if ( EINTR != errno )
+        {
+            myError = errno;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Write at an offset
+ *
+ * Write without moving the current position.\n
+ * With \c OpenMode::Append the data is written at the end of the file whatever \p offset .
+ *
+ * \param offset  The offset of the data in the file.
+ * \param buffer  The data to write.
+ * \param size    The number of bytes to write.
+ *
+ * \return \c true if every byte was written, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool File::writeAt( std::uint64_t offset, const void * buffer, std::size_t size )
+{
+    std::size_t total = 0;
+
+    syncStream();
+
+    myError = 0;
+
+    while ( total < size )
+    {
+        const ssize_t result = ::pwrite( myDescriptor, static_cast< const char * >( buffer ) + total, size - total,
+                                         static_cast< off_t >( offset + total ) );
+
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            // Nothing written without an error, retrying would loop forever
+            myError = EIO;
+
+            return false;
+        }
+        else if ( EINTR != errno )
+        {
+            myError = errno;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Write the data of the file on the device
+ *
+ * The pending writes of the stream are written first.
+ *
+ * \return \c true if the data is on the device, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool File::sync()
+{
+    syncStream();
+
+    myError = ( 0 == ::fsync( myDescriptor ) ) ? 0 : errno;
+
+    return 0 == myError;
+}
+
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the file in bytes, \c 0 on failure.
+ *
+ * \sa getError()
+ */
+std::uint64_t File::getSize()
+{
+    struct stat status;
+
+    syncStream();
+
+    myError = ( 0 == ::fstat( myDescriptor, &status ) ) ? 0 : errno;
+
+    return ( 0 == myError ) ? static_cast< std::uint64_t >( status.st_size ) : 0;
+}
+
+#endif // ELY_POSIX_API
+
+
+/*!
+ * \brief Accessor
+ *
+ * The stream is created the first time.\n
+ * With the POSIX API it reads and writes through the descriptor of the file,
+ * at its current position.
+ *
+ * \return A stream \c FileStream corresonding to the file.
+ */
+File::FileStream & File::getStream() const
+{
+#if defined ( ELY_POSIX_API )
+    if ( ! myStream )
+    {
+        // Without a buffer until the file is open
+        myStream.reset( new FileStream( ELY_NULLPTR ) );
+    }
+
+    if ( isOpen() && ! myStreamBuffer )
+    {
+        myStreamBuffer.reset( new DescriptorStreambuf( myDescriptor ) );
+        myStream->rdbuf( myStreamBuffer.get() );
+    }
+#else
+    if ( ! myStream )
+    {
+        myStream.reset( new FileStream() );
+    }
+#endif
+
+    return *myStream;
 }
 
 
@@ -155,22 +737,27 @@ bool File::rename( const std::string & filePathString )
     close();
 
     FilePath newFilePath( FilePath::baseName( filePathString ) );
-    newFilePath.setAccessPath( myFilePath.getAccessPath() );
+    newFilePath.setAccessPath( std::string( myFilePath.getAccessPath() ) );
 
     // TODO : manage error :  when rename != 0 and why ?
     // new name already exists ? etc.
     // return exception for more infos to the user.
-    int renameCode = std::rename( myFilePath.toString().c_str(), newFilePath.toString().c_str() );
+#if defined ( ELY_POSIX_API )
+    // Falls back to a copy when the access path is on another file system, through a mount point
+    bool isRenamed = moveFile( myFilePath, newFilePath );
+#else
+    bool isRenamed = ( 0 == std::rename( std::string( myFilePath.toString() ).c_str(), std::string( newFilePath.toString() ).c_str() ) );
+#endif
 
     // If the file has been renamed
-    if ( 0 == renameCode )
+    if ( isRenamed )
     {
         myFilePath = std::move( newFilePath );
     }
 
-    open();
+    reopen();
 
-    return ( 0 == renameCode ) ? true : false;
+    return isRenamed;
 }
 
 /*!
@@ -185,18 +772,107 @@ bool File::rename( const std::string & filePathString )
  */
 bool File::rename( const FilePath & filePath )
 {
-    return rename( filePath.getName() );
+    return rename( std::string( filePath.getName() ) );
+}
+
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief Copy the file
+ *
+ * Copy the file in \p filePath , replaced if it exists.\n
+ * The pending writes are flushed first and the data is copied by the kernel.
+ *
+ * \param filePath    A \c FilePath object representing the path of the copy.
+ *
+ * \return \c true if the file was successfully copied, \c false otherwise.
+ *
+ * \sa copyFile()
+ */
+bool File::copyTo( const FilePath & filePath )
+{
+    syncStream();
+
+    return copyFile( myFilePath, filePath );
+}
+
+/*!
+ * \brief Move the file
+ *
+ * Move the file to \p filePath , replaced if it exists, even on another file system.\n
+ * After moving the file is still in open state.
+ *
+ * \param filePath    A \c FilePath object representing the new path of the file.
+ *
+ * \return \c true if the file was successfully moved, \c false otherwise.
+ *
+ * \sa moveFile()
+ */
+bool File::moveTo( const FilePath & filePath )
+{
+    const bool wasOpen = isOpen();
+
+    close();
+
+    const bool isMoved = moveFile( myFilePath, filePath );
+
+    if ( isMoved )
+    {
+        myFilePath = filePath;
+    }
+
+    if ( wasOpen )
+    {
+        reopen();
+    }
+
+    return isMoved;
 }
 
+#endif // ELY_POSIX_API
+
 bool File::erase()
 {
     close();
 
-    int removeCode = std::remove( FilePath::toSystemSeparator( myFilePath.toString() ).c_str() );
+    int removeCode = std::remove( FilePath::toSystemSeparator( std::string( myFilePath.toString() ) ).c_str() );
 
     return ( 0 == removeCode ) ? true : false;
 }
 
 
+//
+// Private functions
+//
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief Synchronize the descriptor with the stream, before accessing it directly.
+ */
+void File::syncStream() const
+{
+    if ( myStreamBuffer )
+    {
+        myStreamBuffer->pubsync();
+    }
+}
+
+#endif // ELY_POSIX_API
+
+/*!
+ * \brief Open the file again
+ *
+ * Open the file with its open mode, without truncating it nor requiring to create it.
+ */
+void File::reopen()
+{
+    const OpenMode mode = myOpenMode;
+
+    myOpenMode = myOpenMode - ( OpenMode::Truncate | OpenMode::Exclusive );
+    open();
+    myOpenMode = mode;
+}
+
+
 } // namespace ::ely::file_system
 } // namespace ::ely
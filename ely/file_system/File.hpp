@@ -1,11 +1,16 @@
 #ifndef FILE_H
 #define FILE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <fstream>
+#include <istream>
 
+#include "ely/config.hpp"
 #include "ely/file_system/FilePath.hpp"
+#include "ely/file_system/OpenMode.hpp"
 
 namespace ely
 {
@@ -18,16 +23,30 @@ namespace file_system
  *
  * \brief Read and write in to a file.
  *
- * This class allows to manage files with TODO : end this
+ * This class allows to manage files with a file descriptor opened with an \c OpenMode ,
+ * read and written without buffering, at the current position or at given offsets.\n
+ * The formatted stream operators go through a buffered stream on the same descriptor :
+ * its pending writes are flushed and its read ahead data is dropped before each direct access,
+ * so both can be mixed.
+ *
+ * Without the POSIX API the file is only accessed through a \c std::fstream ,
+ * the direct accesses, \c OpenMode::Exclusive and \c OpenMode::Direct are not available.
  */
 class File
 {
 public:
+#if defined ( ELY_POSIX_API )
+    typedef std::iostream FileStream;
+#else
     typedef std::fstream FileStream;
+#endif
+
 
+    static constexpr OpenMode defaultOpenMode() noexcept;
 
-    File( const std::string & filePathString );
-    File( const FilePath & filePath );
+
+    File( const std::string & filePathString, OpenMode mode = defaultOpenMode() );
+    File( const FilePath & filePath, OpenMode mode = defaultOpenMode() );
     File( File && file );
 
     File & operator =( File && file );
@@ -40,15 +59,35 @@ public:
     bool open();
     bool open( const std::string & filePathString );
     bool open( const FilePath & filePath );
+    bool open( const FilePath & filePath, OpenMode mode );
     void close();
 
 
+#if defined ( ELY_POSIX_API )
+    std::size_t read( void * buffer, std::size_t size );
+    std::size_t readAt( std::uint64_t offset, void * buffer, std::size_t size );
+    bool write( const void * buffer, std::size_t size );
+    bool writeAt( std::uint64_t offset, const void * buffer, std::size_t size );
+    bool sync();
+#endif
+
+
     bool rename( const std::string & filePathString );
     bool rename( const FilePath & filePath );
     bool erase();
+#if defined ( ELY_POSIX_API )
+    bool copyTo( const FilePath & filePath );
+    bool moveTo( const FilePath & filePath );
+#endif
 
 
     const FilePath & getPath() const;
+    OpenMode getOpenMode() const noexcept;
+    int getError() const noexcept;
+#if defined ( ELY_POSIX_API )
+    int getDescriptor() const noexcept;
+    std::uint64_t getSize();
+#endif
 
     FileStream & getStream() const;
 
@@ -64,12 +103,42 @@ public:
     File & operator >>( T && t );
 
 private:
+#if defined ( ELY_POSIX_API )
+    class DescriptorStreambuf;
+
+
+    void syncStream() const;
+#endif
+    void reopen();
+
+
     FilePath myFilePath;
-    std::unique_ptr< FileStream > myStream;
-    bool myIsOpen;
+    OpenMode myOpenMode;
+#if defined ( ELY_POSIX_API )
+    int myDescriptor;
+#endif
+    int myError;
+#if defined ( ELY_POSIX_API )
+    /// Created on the descriptor by getStream() the first time it is called.
+    mutable std::unique_ptr< DescriptorStreambuf > myStreamBuffer;
+#endif
+    mutable std::unique_ptr< FileStream > myStream;
 };
 
 
+/*!
+ * \brief Constant accessor
+ *
+ * The mode of the former stream : read and write, the file is created if needed and written at its end.
+ *
+ * \return The open mode used when none is given.
+ */
+constexpr OpenMode File::defaultOpenMode() noexcept
+{
+    return OpenMode::ReadWrite | OpenMode::Create | OpenMode::Append;
+}
+
+
 /*!
  * \brief Check if the file is open.
  *
@@ -81,7 +150,11 @@ private:
  */
 inline bool File::isOpen() const
 {
-    return myIsOpen;
+#if defined ( ELY_POSIX_API )
+    return 0 <= myDescriptor;
+#else
+    return myStream && myStream->is_open();
+#endif
 }
 
 
@@ -98,12 +171,34 @@ inline const FilePath & File::getPath() const
 /*!
  * \brief Accessor
  *
- * \return A stream \c FileStream corresonding to the file.
+ * \return The mode used to open the file.
+ */
+inline OpenMode File::getOpenMode() const noexcept
+{
+    return myOpenMode;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The \e errno value of the last failure, \c 0 if the last operation succeeded.
+ */
+inline int File::getError() const noexcept
+{
+    return myError;
+}
+
+#if defined ( ELY_POSIX_API )
+/*!
+ * \brief Accessor
+ *
+ * \return The file descriptor of the file, negative if it's not open.
  */
-inline File::FileStream & File::getStream() const
+inline int File::getDescriptor() const noexcept
 {
-    return *myStream;
+    return myDescriptor;
 }
+#endif
 
 
 /*!
@@ -0,0 +1,415 @@
+#include "ely/file_system/FileHandleCache.hpp"
+
+
+#include <algorithm>
+#include <cerrno>
+#include <functional>
+#include <vector>
+
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/*!
+ * \brief Get the key of a path in the cache.
+ *
+ * The \e . components and the duplicate or trailing separators are removed. The \e .. components
+ * are kept : collapsing them with the previous component is wrong when it is a symbolic link.
+ *
+ * \param path    The path.
+ *
+ * \return The key.
+ */
+std::string toKey( std::string_view path )
+{
+    std::string key;
+
+    key.reserve( path.size() );
+
+    if ( ! path.empty() && '/' == path.front() )
+    {
+        key += '/';
+    }
+
+    for ( std::size_t begin = 0; begin < path.size(); )
+    {
+        const std::size_t end = std::min( path.find( '/', begin ), path.size() );
+        const std::string_view component = path.substr( begin, end - begin );
+
+        if ( ! component.empty() && "." != component )
+        {
+            if ( ! key.empty() && '/' != key.back() )
+            {
+                key += '/';
+            }
+
+            key += component;
+        }
+
+        begin = end + 1;
+    }
+
+    if ( key.empty() )
+    {
+        key = ".";
+    }
+
+    return key;
+}
+
+
+} // namespace
+
+
+//
+// File identity
+//
+
+bool FileHandleCache::FileIdentity::operator ==( const FileIdentity & identity ) const noexcept
+{
+    return device == identity.device && inode == identity.inode;
+}
+
+std::size_t FileHandleCache::FileIdentityHash::operator ()( const FileIdentity & identity ) const noexcept
+{
+    const std::hash< std::uint64_t > hash;
+
+    return hash( identity.inode ) ^ ( hash( identity.device ) * 31 );
+}
+
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * \param capacity    The maximum number of files kept open, at least \c 1 .
+ * \param mode        How the files are opened.
+ */
+FileHandleCache::FileHandleCache( std::size_t capacity, OpenMode mode )
+    : myCapacity( std::max< std::size_t >( capacity, 1 ) ),
+    myOpenMode( mode - ( OpenMode::Truncate | OpenMode::Exclusive ) ),
+    myMutex(),
+    myEntries(),
+    myIndex(),
+    myFiles(),
+    myNumberOfHits( 0 ),
+    myNumberOfMisses( 0 )
+{
+    myIndex.reserve( myCapacity );
+    myFiles.reserve( myCapacity );
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Get an open file.
+ *
+ * The file is opened if its path is not in the cache. If it is another path of a file
+ * already open, the file open is kept and given. Else the least recently used file is closed
+ * if the cache is full.\n
+ * A file which can't be opened is not kept in the cache.
+ *
+ * \param filePath    A \c FilePath object representing the path of the file.
+ *
+ * \return The file, check \c File::isOpen() and \c File::getError() on failure.
+ */
+FileHandleCache::Handle FileHandleCache::acquire( const FilePath & filePath )
+{
+    const std::string key = toKey( filePath.toString() );
+
+    {
+        std::lock_guard< std::mutex > lock( myMutex );
+        const auto found = myIndex.find( key );
+
+        if ( myIndex.end() != found )
+        {
+            myEntries.splice( myEntries.begin(), myEntries, found->second );
+            ++myNumberOfHits;
+
+            return found->second->file;
+        }
+
+        ++myNumberOfMisses;
+    }
+
+    // Opened without blocking the other threads
+    Handle file = std::make_shared< File >( filePath, myOpenMode );
+    struct stat status;
+
+    // Not kept if the file can't be identified
+    if ( ! file->isOpen() || 0 != ::fstat( file->getDescriptor(), &status ) )
+    {
+        return file;
+    }
+
+    const FileIdentity identity { static_cast< std::uint64_t >( status.st_dev ),
+                                  static_cast< std::uint64_t >( status.st_ino ) };
+
+    // Closed once the mutex is released
+    std::vector< Handle > evicted;
+    std::lock_guard< std::mutex > lock( myMutex );
+    const auto found = myIndex.find( key );
+
+    // Opened by another thread meanwhile
+    if ( myIndex.end() != found )
+    {
+        myEntries.splice( myEntries.begin(), myEntries, found->second );
+        evicted.push_back( std::move( file ) );
+
+        return found->second->file;
+    }
+
+    const auto same = myFiles.find( identity );
+
+    // Another path of a file open
+    if ( myFiles.end() != same )
+    {
+        const Entries::iterator entry = same->second;
+
+        entry->paths.push_back( key );
+        myIndex.emplace( entry->paths.back(), entry );
+        myEntries.splice( myEntries.begin(), myEntries, entry );
+        evicted.push_back( std::move( file ) );
+
+        return entry->file;
+    }
+
+    myEntries.push_front( Entry { identity, file, { key } } );
+    myIndex.emplace( myEntries.front().paths.front(), myEntries.begin() );
+    myFiles.emplace( identity, myEntries.begin() );
+
+    while ( myCapacity < myEntries.size() )
+    {
+        evicted.push_back( remove( std::prev( myEntries.end() ) ) );
+    }
+
+    return file;
+}
+
+/*!
+ * \brief Read at an offset of a file.
+ *
+ * Read until \p size bytes are read or the end of the file is reached, without moving
+ * the position of the file.
+ *
+ * \param filePath    A \c FilePath object representing the path of the file.
+ * \param offset      The offset of the first byte to read.
+ * \param buffer      The buffer receiving the data.
+ * \param size        The size of the data to read.
+ * \param error       Receives the failure, cleared on success.
+ *
+ * \return The size of the data read.
+ */
+std::size_t FileHandleCache::readAt( const FilePath & filePath, std::uint64_t offset, void * buffer, std::size_t size,
+                                     std::error_code & error )
+{
+    const Handle file = acquire( filePath );
+    std::size_t total = 0;
+
+    error.clear();
+
+    if ( ! file->isOpen() )
+    {
+        error.assign( file->getError(), std::system_category() );
+
+        return 0;
+    }
+
+    while ( total < size )
+    {
+        const ::ssize_t result = ::pread( file->getDescriptor(), static_cast< char * >( buffer ) + total, size - total,
+                                          static_cast< ::off_t >( offset + total ) );
+
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            break;
+        }
+        else if ( EINTR != errno )
+        {
+            error.assign( errno, std::system_category() );
+            break;
+        }
+    }
+
+    return total;
+}
+
+/*!
+ * \brief Write at an offset of a file.
+ *
+ * Write the whole data without moving the position of the file.
+ *
+ * \param filePath    A \c FilePath object representing the path of the file.
+ * \param offset      The offset where the data is written.
+ * \param buffer      The data to write.
+ * \param size        The size of the data.
+ * \param error       Receives the failure, cleared on success.
+ *
+ * \return \c true if the data was written, \c false otherwise.
+ */
+bool FileHandleCache::writeAt( const FilePath & filePath, std::uint64_t offset, const void * buffer, std::size_t size,
+                               std::error_code & error )
+{
+    const Handle file = acquire( filePath );
+    std::size_t total = 0;
+
+    error.clear();
+
+    if ( ! file->isOpen() )
+    {
+        error.assign( file->getError(), std::system_category() );
+
+        return false;
+    }
+
+    while ( total < size )
+    {
+        const ::ssize_t result = ::pwrite( file->getDescriptor(), static_cast< const char * >( buffer ) + total,
+                                           size - total, static_cast< ::off_t >( offset + total ) );
+
+        if ( 0 < result )
+        {
+            total += static_cast< std::size_t >( result );
+        }
+        else if ( 0 == result )
+        {
+            error.assign( EIO, std::system_category() );
+
+            return false;
+        }
+        else if ( EINTR != errno )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Remove a file from the cache, with its other paths.
+ *
+ * The file is closed once its handles are released, call it when the file is removed or replaced.
+ *
+ * \param filePath    A \c FilePath object representing the path of the file.
+ */
+void FileHandleCache::erase( const FilePath & filePath )
+{
+    Handle evicted;
+    std::lock_guard< std::mutex > lock( myMutex );
+    const auto found = myIndex.find( toKey( filePath.toString() ) );
+
+    if ( myIndex.end() != found )
+    {
+        evicted = remove( found->second );
+    }
+}
+
+/*!
+ * \brief Remove every file from the cache.
+ */
+void FileHandleCache::clear()
+{
+    Entries evicted;
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    myIndex.clear();
+    myFiles.clear();
+    evicted.swap( myEntries );
+}
+
+
+//
+// Accessors
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of files kept open by the cache.
+ */
+std::size_t FileHandleCache::getSize() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myEntries.size();
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of files acquired which were open.
+ */
+std::uint64_t FileHandleCache::getNumberOfHits() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myNumberOfHits;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of files acquired which had to be opened.
+ */
+std::uint64_t FileHandleCache::getNumberOfMisses() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myNumberOfMisses;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Remove an entry with its paths.
+ *
+ * The mutex must be locked.
+ *
+ * \param entry   The entry to remove.
+ *
+ * \return The file of the entry, to close once the mutex is released.
+ */
+FileHandleCache::Handle FileHandleCache::remove( Entries::iterator entry )
+{
+    Handle file = std::move( entry->file );
+
+    for ( const std::string & path : entry->paths )
+    {
+        myIndex.erase( path );
+    }
+
+    myFiles.erase( entry->identity );
+    myEntries.erase( entry );
+
+    return file;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
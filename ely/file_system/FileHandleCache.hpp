@@ -0,0 +1,173 @@
+/*!
+ * \file FileHandleCache.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the FileHandleCache class.
+ */
+#ifndef FILE_HANDLE_CACHE_HPP
+#define FILE_HANDLE_CACHE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/File.hpp"
+#include "ely/file_system/FilePath.hpp"
+#include "ely/file_system/OpenMode.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The FileHandleCache class
+ *
+ * Keeps the most recently used files open.\n\n
+ *
+ * A file is opened the first time it is acquired and stays open while it is among the
+ * \c getCapacity() files used the most recently. The least recently used file is closed
+ * when another one is opened, and reopened the next time it is acquired.\n
+ * A \c Handle acquired keeps its file open, even once evicted : the number of open files
+ * can exceed the capacity by the number of handles held. Every open file, cached or held,
+ * counts against the limit of file descriptors of the process, \e RLIMIT_NOFILE .\n\n
+ *
+ * The paths are looked up without their \e . components and duplicate separators : \e a/./b
+ * and \e a//b are the same path. A path acquired for the first time is opened, then identified by
+ * the device and the inode of its file : the hard links and the paths through symbolic links
+ * share the file already open.\n\n
+ *
+ * The cache can be shared by many threads. The \c File of a handle is shared too and is not
+ * synchronized : \c readAt() and \c writeAt() of the cache can be called concurrently, they
+ * read and write at offsets with their own error.\n
+ * \c OpenMode::Truncate and \c OpenMode::Exclusive are ignored since the files are reopened.
+ */
+class FileHandleCache final
+{
+public:
+    /// A file kept open.
+    typedef std::shared_ptr< File > Handle;
+
+
+    static constexpr std::size_t defaultCapacity() noexcept;
+
+
+    explicit FileHandleCache( std::size_t capacity = defaultCapacity(), OpenMode mode = OpenMode::Read );
+
+    FileHandleCache( const FileHandleCache & ) = delete;
+    FileHandleCache & operator =( const FileHandleCache & ) = delete;
+
+
+    Handle acquire( const FilePath & filePath );
+
+    std::size_t readAt( const FilePath & filePath, std::uint64_t offset, void * buffer, std::size_t size,
+                        std::error_code & error );
+    bool writeAt( const FilePath & filePath, std::uint64_t offset, const void * buffer, std::size_t size,
+                  std::error_code & error );
+
+    void erase( const FilePath & filePath );
+    void clear();
+
+
+    std::size_t getCapacity() const noexcept;
+    OpenMode getOpenMode() const noexcept;
+    std::size_t getSize() const;
+    std::uint64_t getNumberOfHits() const;
+    std::uint64_t getNumberOfMisses() const;
+
+private:
+    /// The identity of a file, shared by all its paths.
+    struct FileIdentity
+    {
+        bool operator ==( const FileIdentity & identity ) const noexcept;
+
+
+        std::uint64_t device;
+        std::uint64_t inode;
+    };
+
+    /// The hash of a file identity.
+    struct FileIdentityHash
+    {
+        std::size_t operator ()( const FileIdentity & identity ) const noexcept;
+    };
+
+    /// An open file.
+    struct Entry
+    {
+        FileIdentity identity;
+        Handle file;
+        /// The paths acquired of the file, the keys of the index.
+        std::list< std::string > paths;
+    };
+
+    /// The open files, from the most to the least recently used.
+    typedef std::list< Entry > Entries;
+
+
+    Handle remove( Entries::iterator entry );
+
+
+    const std::size_t myCapacity;
+    const OpenMode myOpenMode;
+
+    mutable std::mutex myMutex;
+    Entries myEntries;
+    /// The entries by path, the keys are the paths stored in the entries.
+    std::unordered_map< std::string_view, Entries::iterator > myIndex;
+    /// The entries by file.
+    std::unordered_map< FileIdentity, Entries::iterator, FileIdentityHash > myFiles;
+    std::uint64_t myNumberOfHits;
+    std::uint64_t myNumberOfMisses;
+};
+
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default number of files kept open.
+ */
+constexpr std::size_t FileHandleCache::defaultCapacity() noexcept
+{
+    return 1024;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The maximum number of files kept open by the cache.
+ */
+inline std::size_t FileHandleCache::getCapacity() const noexcept
+{
+    return myCapacity;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return How the files are opened.
+ */
+inline OpenMode FileHandleCache::getOpenMode() const noexcept
+{
+    return myOpenMode;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // FILE_HANDLE_CACHE_HPP
@@ -58,11 +58,8 @@ string FilePath::extractExtension( const string & filename, const char separator
  * \sa FilePath( FilePath && )
  */
 FilePath::FilePath( const string & filePathString )
-    : Path( filePathString ),
-    myExtension( extractExtension( myName ) )
-{
-    myName = baseName( myName, extensionSeparator() + myExtension );
-}
+    : Path( filePathString )
+{}
 
 /*!
  * \brief Constructor
@@ -76,8 +73,7 @@ FilePath::FilePath( const string & filePathString )
  * \sa FilePath( FilePath && )
  */
 FilePath::FilePath( const FilePath & filePath ) noexcept
-    : Path( filePath ),
-    myExtension( filePath.myExtension )
+    : Path( filePath )
 {}
 
 /*!
@@ -94,8 +90,7 @@ FilePath::FilePath( const FilePath & filePath ) noexcept
  * \sa FilePath( FilePath && )
  */
 FilePath::FilePath( FilePath && filePath ) noexcept
-    : Path( std::forward< FilePath >( filePath ) ),
-    myExtension( std::move( filePath.myExtension ) )
+    : Path( std::forward< FilePath >( filePath ) )
 {}
 
 /*!
@@ -113,8 +108,6 @@ FilePath::FilePath( FilePath && filePath ) noexcept
 FilePath & FilePath::operator =( const string & filePathString ) noexcept
 {
     Path::operator =( filePathString );
-    myExtension = extractExtension( myName );
-    myName = baseName( myName, extensionSeparator() + myExtension );
 
     return *this;
 }
@@ -134,7 +127,6 @@ FilePath & FilePath::operator =( const string & filePathString ) noexcept
 FilePath & FilePath::operator =( const FilePath & filePath ) noexcept
 {
     Path::operator =( filePath );
-    myExtension = filePath.myExtension;
 
     return *this;
 }
@@ -153,13 +145,59 @@ FilePath & FilePath::operator =( const FilePath & filePath ) noexcept
  */
 FilePath & FilePath::operator =( FilePath && filePath ) noexcept
 {
-    Path::operator =( filePath );
-    myExtension = std::move( filePath.myExtension );
+    Path::operator =( std::move( filePath ) );
 
     return *this;
 }
 
 
+//
+// Accessors
+//
+
+/*!
+ * \brief Accessor
+ *
+ * Replace the actual name of the file with \p name, keeping its extension.
+ *
+ * \param name The new name of the file, whithout its extension.
+ */
+void FilePath::setName( const string & name )
+{
+    const std::string_view::size_type separatorPosition = getExtensionSeparatorPosition();
+
+    if ( std::string_view::npos != separatorPosition )
+    {
+        Path::setName( name + string( getName().substr( separatorPosition ) ) );
+    }
+    else
+    {
+        Path::setName( name );
+    }
+}
+
+/*!
+ * \brief Accessor
+ *
+ * Replace the actual extenion with \p extension
+ *
+ * \param extension The new extension of the file, whithout the separator.\n
+ * The separator is removed too if \p extension is empty.
+ */
+void FilePath::setExtension( const string & extension )
+{
+    const std::string_view name( getName() );
+    string newName( name.substr( 0, getExtensionSeparatorPosition() ) );
+
+    if ( false == extension.empty() )
+    {
+        newName += extensionSeparator() + extension;
+    }
+
+    Path::setName( newName );
+}
+
+
 //
 // Private functions
 //
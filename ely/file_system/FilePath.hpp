@@ -29,7 +29,8 @@ namespace file_system
  * A path is composed of its access path (the path to the directory containing the file) and its name (the filename).\n
  * Exemple : \e /home/ely/script.sh\n
  * \e /home/ely is the access path.\n
- * \e script.sh is the name.
+ * \e script.sh is the name.\n
+ * \e sh is the extension, the end of the name.
  */
 class FilePath : public Path
 {
@@ -46,10 +47,10 @@ public:
     FilePath & operator =( FilePath && path ) noexcept;
 
 
-    std::string getName() const noexcept override;
+    void setName( const std::string & name ) override;
 
-    std::string getExtension() const noexcept;
-    void setExtension( const std::string & extension = std::string() ) noexcept;
+    std::string_view getExtension() const noexcept;
+    void setExtension( const std::string & extension = std::string() );
 
 private:
     static constexpr char extensionSeparator() noexcept;
@@ -61,7 +62,7 @@ private:
     Clone doClone() const override;
 
 
-    std::string myExtension;
+    std::string_view::size_type getExtensionSeparatorPosition() const noexcept;
 };
 
 
@@ -72,39 +73,29 @@ private:
 /*!
  * \brief Accessor
  *
- * \return The name of the file with its extension.
+ * \return The extension of the file.
  */
-inline std::string FilePath::getName() const noexcept
+inline std::string_view FilePath::getExtension() const noexcept
 {
-    std::string fullName( myName );
-
-    if ( false == myExtension.empty() )
-    {
-        fullName += extensionSeparator() + myExtension;
-    }
+    const std::string_view name( getName() );
+    const std::string_view::size_type separatorPosition = getExtensionSeparatorPosition();
 
-    return fullName;
+    return ( std::string_view::npos != separatorPosition ) ? name.substr( separatorPosition + 1 ) : std::string_view();
 }
 
+
+//
+// Private functions
+//
+
 /*!
- * \brief Accessor
+ * \brief Find the separator of the extension.
  *
- * \return The extension of the file.
+ * \return The position of the extension's separator in the name, \c std::string_view::npos if there is none.
  */
-inline std::string FilePath::getExtension() const noexcept
+inline std::string_view::size_type FilePath::getExtensionSeparatorPosition() const noexcept
 {
-    return myExtension;
-}
-/*!
- * \brief Accessor
- *
- * Replace the actual extenion with \p extension
- *
- * \param extension The new extension of the file, whithout the separator.
- */
-inline void FilePath::setExtension( const std::string & extension ) noexcept
-{
-    myExtension = extension;
+    return getName().find_last_of( extensionSeparator() );
 }
 
 
@@ -126,4 +117,21 @@ constexpr char FilePath::extensionSeparator() noexcept
 } // namespace ::ely::file_system
 } // namespace ::ely
 
+
+namespace std
+{
+
+
+/*!
+ * \brief Specialization of hash
+ *
+ * Uses the hash cached by the path.
+ */
+template <>
+struct hash< ::ely::file_system::FilePath > : hash< ::ely::file_system::Path >
+{};
+
+
+} // namespace ::std
+
 #endif // FILE_PATH_HPP
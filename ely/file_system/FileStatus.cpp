@@ -0,0 +1,161 @@
+#include "ely/file_system/FileStatus.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <cerrno>
+#include <new>
+#include <string>
+
+
+#include <dirent.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/*!
+ * \brief Read the metadata of a file.
+ *
+ * \param path            The path of the file.
+ * \param status          Receives the metadata.
+ * \param error           Receives the reason of the failure, cleared on success.
+ * \param isLinkFollowed  \c true to read the target of a symbolic link, \c false to read the link.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ */
+bool readStatus( const Path & path, FileStatus & status, std::error_code & error, bool isLinkFollowed ) noexcept
+{
+    error.clear();
+
+    try
+    {
+        const std::string pathString( path.toString() );
+        struct stat result;
+
+        if ( 0 != ( isLinkFollowed ? ::stat( pathString.c_str(), &result ) : ::lstat( pathString.c_str(), &result ) ) )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+
+        status = FileStatus::fromStat( result );
+    }
+    catch ( const std::bad_alloc & )
+    {
+        error = std::make_error_code( std::errc::not_enough_memory );
+
+        return false;
+    }
+
+    return true;
+}
+
+
+} // namespace
+
+
+//
+// FileStatus public static functions
+//
+
+/*!
+ * \brief Convert the result of \e stat .
+ *
+ * \param status  The result of \e stat .
+ *
+ * \return The metadata.
+ */
+FileStatus FileStatus::fromStat( const struct stat & status ) noexcept
+{
+    return { static_cast< Directory::EntryType >( IFTODT( status.st_mode ) ),
+             static_cast< std::uint64_t >( status.st_size ),
+             static_cast< std::int64_t >( status.st_mtim.tv_sec ) * 1000000000 + status.st_mtim.tv_nsec,
+             static_cast< std::uint64_t >( status.st_ino ),
+             static_cast< std::uint64_t >( status.st_dev ) };
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Read the metadata of a file.
+ *
+ * The metadata of the target of a symbolic link is read.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ *
+ * \sa getStatus( const Path &, FileStatus &, std::error_code & )
+ */
+bool getStatus( const Path & path, FileStatus & status )
+{
+    std::error_code error;
+
+    return getStatus( path, status, error );
+}
+
+/*!
+ * \brief Read the metadata of a file.
+ *
+ * The metadata of the target of a symbolic link is read.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ * \param error   Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ */
+bool getStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept
+{
+    return readStatus( path, status, error, true );
+}
+
+/*!
+ * \brief Read the metadata of a file without following a symbolic link.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ *
+ * \sa getLinkStatus( const Path &, FileStatus &, std::error_code & )
+ */
+bool getLinkStatus( const Path & path, FileStatus & status )
+{
+    std::error_code error;
+
+    return getLinkStatus( path, status, error );
+}
+
+/*!
+ * \brief Read the metadata of a file without following a symbolic link.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ * \param error   Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ */
+bool getLinkStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept
+{
+    return readStatus( path, status, error, false );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
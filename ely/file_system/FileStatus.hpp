@@ -0,0 +1,70 @@
+/*!
+ * \file FileStatus.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file for the metadata of the files.
+ */
+#ifndef FILE_STATUS_HPP
+#define FILE_STATUS_HPP
+
+
+#include <cstdint>
+#include <system_error>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/Directory.hpp"
+#include "ely/file_system/Path.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <sys/stat.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The FileStatus struct
+ *
+ * The metadata of a file read by \e stat .
+ */
+struct FileStatus
+{
+    static FileStatus fromStat( const struct stat & status ) noexcept;
+
+
+    /// The type of the file.
+    Directory::EntryType type;
+    /// The size in bytes.
+    std::uint64_t size;
+    /// The time of the last modification of the content, in nanoseconds since the epoch.
+    std::int64_t modificationTime;
+    /// The inode number.
+    std::uint64_t inode;
+    /// The device holding the file.
+    std::uint64_t device;
+};
+
+
+bool getStatus( const Path & path, FileStatus & status );
+bool getStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept;
+
+bool getLinkStatus( const Path & path, FileStatus & status );
+bool getLinkStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept;
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
+
+
+#endif // FILE_STATUS_HPP
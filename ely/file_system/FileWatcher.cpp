@@ -0,0 +1,380 @@
+#include "ely/file_system/FileWatcher.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <iterator>
+#include <utility>
+
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+
+ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( const ::ely::file_system::Path &, ::ely::file_system::FileWatcher::Event )
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/// The events watched.
+constexpr std::uint32_t watchedEvents = IN_CREATE | IN_MODIFY | IN_ATTRIB | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                        IN_DELETE_SELF | IN_MOVE_SELF;
+
+/// The size of the largest event.
+constexpr std::size_t maximumEventSize = sizeof( ::inotify_event ) + NAME_MAX + 1;
+
+
+} // namespace
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * \param bufferSize  The size of the buffer of the events, large enough for at least one event.
+ *
+ * \sa isValid()
+ */
+FileWatcher::FileWatcher( std::size_t bufferSize )
+    : changed(),
+    myDescriptor( ::inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) ),
+    myBufferSize( std::max( bufferSize, maximumEventSize ) ),
+    myBuffer( new char[ myBufferSize ] ),
+    myMutex(),
+    myPaths(),
+    myWatches(),
+    myError()
+{
+    if ( ! isValid() )
+    {
+        myError.assign( errno, std::system_category() );
+    }
+}
+
+/*!
+ * \brief Destructor
+ *
+ * Closing the \e inotify instance removes every watch.
+ */
+FileWatcher::~FileWatcher()
+{
+    if ( isValid() )
+    {
+        ::close( myDescriptor );
+    }
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Watch a file or a directory.
+ *
+ * \param path    The path of the file or of the directory.
+ *
+ * \return \c true if the path is watched, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool FileWatcher::watch( const Path & path )
+{
+    const std::string pathString( path.toString() );
+    std::lock_guard< std::mutex > lock( myMutex );
+    const int watch = ::inotify_add_watch( myDescriptor, pathString.c_str(), watchedEvents );
+
+    if ( -1 == watch )
+    {
+        myError.assign( errno, std::system_category() );
+
+        return false;
+    }
+
+    const auto found = myWatches.find( pathString );
+
+    myError.clear();
+
+    if ( myWatches.end() != found && watch == found->second )
+    {
+        return true;
+    }
+
+    // Another path of the same file keeps the first path
+    ++myPaths.emplace( watch, WatchedPath { path, 0 } ).first->second.references;
+
+    if ( myWatches.end() == found )
+    {
+        myWatches.emplace( pathString, watch );
+    }
+    else
+    {
+        // The path names another file since it was watched
+        release( std::exchange( found->second, watch ), pathString );
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Stop watching a file or a directory.
+ *
+ * \param path    The path given to \c watch() .
+ *
+ * \return \c true if the path was watched, \c false otherwise.
+ */
+bool FileWatcher::unwatch( const Path & path )
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+    const std::string pathString( path.toString() );
+    const auto found = myWatches.find( pathString );
+
+    if ( myWatches.end() == found )
+    {
+        return false;
+    }
+
+    const int watch = found->second;
+
+    myWatches.erase( found );
+    release( watch, pathString );
+
+    return true;
+}
+
+/*!
+ * \brief Emit the pending events, without waiting.
+ *
+ * Every pending event is read, by batches as large as the buffer.
+ *
+ * \return The number of events emitted.
+ *
+ * \sa getError()
+ */
+std::size_t FileWatcher::poll()
+{
+    std::size_t numberOfEvents = 0;
+    ::ssize_t size;
+
+    while ( 0 < ( size = ::read( myDescriptor, myBuffer.get(), myBufferSize ) ) )
+    {
+        for ( const char * event = myBuffer.get(); event < myBuffer.get() + size; )
+        {
+            // The events are aligned for inotify_event by the kernel
+            const ::inotify_event & header = *reinterpret_cast< const ::inotify_event * >( event );
+            const char * name = ( 0 != header.len ) ? header.name : nullptr;
+
+            event += sizeof( ::inotify_event ) + header.len;
+
+            if ( 0 != ( header.mask & IN_Q_OVERFLOW ) )
+            {
+                changed( Path(), Event::Overflow );
+                ++numberOfEvents;
+            }
+            else if ( 0 != ( header.mask & IN_IGNORED ) )
+            {
+                // Removed by unwatch() or by the kernel with the file
+                std::lock_guard< std::mutex > lock( myMutex );
+
+                forget( header.wd );
+            }
+            else
+            {
+                Event changeEvent;
+
+                if ( 0 != ( header.mask & IN_CREATE ) )
+                {
+                    changeEvent = Event::Created;
+                }
+                else if ( 0 != ( header.mask & ( IN_DELETE | IN_DELETE_SELF | IN_UNMOUNT ) ) )
+                {
+                    changeEvent = Event::Deleted;
+                }
+                else if ( 0 != ( header.mask & ( IN_MOVED_FROM | IN_MOVE_SELF ) ) )
+                {
+                    changeEvent = Event::MovedFrom;
+                }
+                else if ( 0 != ( header.mask & IN_MOVED_TO ) )
+                {
+                    changeEvent = Event::MovedTo;
+                }
+                else
+                {
+                    changeEvent = Event::Modified;
+                }
+
+                numberOfEvents += emitEvent( header.wd, name, changeEvent ) ? 1 : 0;
+            }
+        }
+    }
+
+    if ( 0 > size && EAGAIN != errno && EINTR != errno )
+    {
+        std::lock_guard< std::mutex > lock( myMutex );
+
+        myError.assign( errno, std::system_category() );
+    }
+
+    return numberOfEvents;
+}
+
+/*!
+ * \brief Wait for events and emit them.
+ *
+ * \param timeout     The maximum time to wait in milliseconds, \c -1 to wait without limit.
+ *
+ * \return The number of events emitted, \c 0 if none happened before the timeout.
+ */
+std::size_t FileWatcher::wait( int timeout )
+{
+    ::pollfd descriptor = { myDescriptor, POLLIN, 0 };
+
+    if ( 0 < ::poll( &descriptor, 1, timeout ) )
+    {
+        return poll();
+    }
+
+    return 0;
+}
+
+
+//
+// Accessors
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of paths watched.
+ */
+std::size_t FileWatcher::getNumberOfWatches() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myWatches.size();
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The failure of the last watch or reading, empty if there is none.
+ */
+std::error_code FileWatcher::getError() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myError;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Emit an event with the path of its file.
+ *
+ * The mutex is released before the emission, so the slots can watch and unwatch paths.
+ *
+ * \param watch   The watch descriptor of the event.
+ * \param name    The name of the file in the directory watched, \c nullptr for the path watched itself.
+ * \param event   The change.
+ *
+ * \return \c true if the event was emitted, \c false if its path isn't watched anymore.
+ */
+bool FileWatcher::emitEvent( int watch, const char * name, Event event )
+{
+    Path path;
+
+    {
+        std::lock_guard< std::mutex > lock( myMutex );
+        const auto found = myPaths.find( watch );
+
+        // Unwatched while the event was pending
+        if ( myPaths.end() == found )
+        {
+            return false;
+        }
+
+        path = ( nullptr != name ) ? Path::join( found->second.path, name ) : found->second.path;
+    }
+
+    changed( path, event );
+
+    return true;
+}
+
+/*!
+ * \brief Release the reference of a path on its watch, the watch is removed without reference.
+ *
+ * The mutex must be locked and the path must not be in \c myWatches anymore.
+ *
+ * \param watch       The watch descriptor.
+ * \param pathString  The path unwatched.
+ */
+void FileWatcher::release( int watch, const std::string & pathString )
+{
+    const auto found = myPaths.find( watch );
+
+    if ( myPaths.end() == found )
+    {
+        return;
+    }
+
+    if ( 0 == --found->second.references )
+    {
+        ::inotify_rm_watch( myDescriptor, watch );
+        myPaths.erase( found );
+    }
+    else if ( found->second.path.toString() == pathString )
+    {
+        // The events take another path of the file still watched
+        const auto other = std::find_if( myWatches.begin(), myWatches.end(), [ watch ]( const auto & entry )
+        {
+            return watch == entry.second;
+        } );
+
+        found->second.path = Path( other->first );
+    }
+}
+
+/*!
+ * \brief Forget a watch removed by the kernel, with every path watched with it.
+ *
+ * The mutex must be locked. The paths watched again since then have another watch and are kept.
+ *
+ * \param watch   The watch descriptor.
+ */
+void FileWatcher::forget( int watch )
+{
+    if ( 0 == myPaths.erase( watch ) )
+    {
+        return;
+    }
+
+    for ( auto entry = myWatches.begin(); entry != myWatches.end(); )
+    {
+        entry = ( watch == entry->second ) ? myWatches.erase( entry ) : std::next( entry );
+    }
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
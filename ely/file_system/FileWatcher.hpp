@@ -0,0 +1,177 @@
+/*!
+ * \file FileWatcher.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the FileWatcher class.
+ */
+#ifndef FILE_WATCHER_HPP
+#define FILE_WATCHER_HPP
+
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/Path.hpp"
+#include "ely/signals_slots/Signal.hpp"
+#include "ely/signals_slots/instantiation.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The FileWatcher class
+ *
+ * Watches the changes of files and directories with \e inotify and emits them with a signal.\n\n
+ *
+ * The changes of the files of a directory watched are emitted with the path of the file,
+ * the changes of a file watched or of a directory watched itself with its own path.\n
+ * The events are read by large batches in a buffer reused by every reading, and \c poll()
+ * reads every pending event : the descriptor can be waited edge-triggered with \e epoll .
+ * The slots are called by the thread calling \c poll() or \c wait() , and can watch or
+ * unwatch paths. Only one thread at a time can read the events.\n\n
+ *
+ * The subdirectories are not watched, each directory must be watched. When events are lost
+ * because too many were pending, \c Event::Overflow is emitted with an empty path.\n
+ * The paths of the same file, through links or hard links, share their watch : the events are
+ * emitted once, with the first of these paths still watched, until every path is unwatched.
+ */
+class FileWatcher final
+{
+public:
+    /// A change of a file.
+    enum class Event : unsigned char
+    {
+        /// Created in a directory watched.
+        Created,
+        /// Content or metadata modified.
+        Modified,
+        /// Removed.
+        Deleted,
+        /// Renamed from this path.
+        MovedFrom,
+        /// Renamed to this path.
+        MovedTo,
+        /// Events were lost.
+        Overflow
+    };
+
+    /// The signal emitting the changes.
+    typedef signals_slots::Signal< const Path &, Event > ChangedSignal;
+
+
+    static constexpr std::size_t defaultBufferSize() noexcept;
+
+
+    explicit FileWatcher( std::size_t bufferSize = defaultBufferSize() );
+    ~FileWatcher();
+
+    FileWatcher( const FileWatcher & ) = delete;
+    FileWatcher & operator =( const FileWatcher & ) = delete;
+
+
+    bool watch( const Path & path );
+    bool unwatch( const Path & path );
+
+    std::size_t poll();
+    std::size_t wait( int timeout = -1 );
+
+
+    bool isValid() const noexcept;
+    int getDescriptor() const noexcept;
+    std::size_t getNumberOfWatches() const;
+    std::error_code getError() const;
+
+
+    /// Emitted for each change.
+    ChangedSignal changed;
+
+private:
+    /// A watch descriptor and the paths watched with it.
+    struct WatchedPath
+    {
+        /// The path of the events.
+        Path path;
+        /// The number of paths watched with the descriptor.
+        std::size_t references;
+    };
+
+
+    bool emitEvent( int watch, const char * name, Event event );
+    void release( int watch, const std::string & pathString );
+    void forget( int watch );
+
+
+    const int myDescriptor;
+    const std::size_t myBufferSize;
+    const std::unique_ptr< char[] > myBuffer;
+
+    mutable std::mutex myMutex;
+    /// The paths watched by watch descriptor.
+    std::unordered_map< int, WatchedPath > myPaths;
+    /// The watch descriptors by path watched.
+    std::unordered_map< std::string, int > myWatches;
+    std::error_code myError;
+};
+
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default size of the buffer of the events.
+ */
+constexpr std::size_t FileWatcher::defaultBufferSize() noexcept
+{
+    return 64 * 1024;
+}
+
+/*!
+ * \brief Check if the changes can be watched.
+ *
+ * \return \c true if the \e inotify instance was created, \c false otherwise.
+ */
+inline bool FileWatcher::isValid() const noexcept
+{
+    return -1 != myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The descriptor of the \e inotify instance, readable when events are pending.
+ */
+inline int FileWatcher::getDescriptor() const noexcept
+{
+    return myDescriptor;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+// The signals/slots of the watcher are compiled once in the library, see FileWatcher.cpp
+#if ! defined ( ELY_SIGNALS_SLOTS_NO_EXTERN_TEMPLATES )
+
+ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( const ::ely::file_system::Path &, ::ely::file_system::FileWatcher::Event )
+
+#endif // ELY_SIGNALS_SLOTS_NO_EXTERN_TEMPLATES
+
+
+#endif // ELY_USING_LINUX_API
+
+
+#endif // FILE_WATCHER_HPP
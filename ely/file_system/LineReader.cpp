@@ -0,0 +1,168 @@
+#include "ely/file_system/LineReader.hpp"
+
+
+#include <algorithm>
+#include <cstring>
+
+
+#include "ely/file_system/separators.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a reader of the lines of \p file from its current position.
+ *
+ * \param file        The open file to read, must outlive the reader.
+ * \param bufferSize  The initial size of the buffer.
+ */
+LineReader::LineReader( File & file, std::size_t bufferSize )
+    : myFile( &file ),
+    myBufferSize( std::max< std::size_t >( bufferSize, 1 ) ),
+    myBuffer( new char[ myBufferSize ] ),
+    myContent(),
+    myScannedSize( 0 ),
+    myIsEndOfFile( false ),
+    myLineNumber( 0 ),
+    myError( 0 )
+{}
+
+#if defined ( ELY_POSIX_API )
+
+/*!
+ * \brief Constructor
+ *
+ * Create a reader of the lines of a mapped file.
+ *
+ * \param file    The mapped file, must outlive the reader.
+ */
+LineReader::LineReader( const MappedFile & file ) noexcept
+    : LineReader( file.getContent() )
+{}
+
+#endif // ELY_POSIX_API
+
+/*!
+ * \brief Constructor
+ *
+ * Create a reader of the lines of \p content .
+ *
+ * \param content     The content to read, must outlive the reader.
+ */
+LineReader::LineReader( std::string_view content ) noexcept
+    : myFile( nullptr ),
+    myBufferSize( 0 ),
+    myBuffer(),
+    myContent( content ),
+    myScannedSize( 0 ),
+    myIsEndOfFile( true ),
+    myLineNumber( 0 ),
+    myError( 0 )
+{}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Read the next line.
+ *
+ * \param line    Receives the line, valid until the next call.
+ *
+ * \return \c true if a line was read, \c false at the end or on a reading failure.
+ *
+ * \sa getError()
+ */
+bool LineReader::next( std::string_view & line )
+{
+    for ( ; ; )
+    {
+        const std::size_t position = separators::findFirst( myContent, '\n', '\n', myScannedSize );
+
+        if ( std::string_view::npos != position )
+        {
+            line = myContent.substr( 0, position );
+            myContent.remove_prefix( position + 1 );
+            myScannedSize = 0;
+            ++myLineNumber;
+
+            return true;
+        }
+
+        myScannedSize = myContent.size();
+
+        if ( myIsEndOfFile || ! fill() )
+        {
+            break;
+        }
+    }
+
+    // The last line without line feed
+    if ( myContent.empty() )
+    {
+        return false;
+    }
+
+    line = myContent;
+    myContent = std::string_view();
+    myScannedSize = 0;
+    ++myLineNumber;
+
+    return true;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Read the next block of the file after the content not read yet.
+ *
+ * \return \c true if data was read, \c false at the end of the file or on failure.
+ */
+bool LineReader::fill()
+{
+    const std::size_t remainingSize = myContent.size();
+
+    if ( remainingSize == myBufferSize )
+    {
+        // A line longer than the buffer
+        std::unique_ptr< char[] > buffer( new char[ 2 * myBufferSize ] );
+
+        std::memcpy( buffer.get(), myContent.data(), remainingSize );
+        myBuffer = std::move( buffer );
+        myBufferSize *= 2;
+    }
+    else if ( 0 != remainingSize )
+    {
+        std::memmove( myBuffer.get(), myContent.data(), remainingSize );
+    }
+
+    const std::size_t readSize = myFile->read( myBuffer.get() + remainingSize, myBufferSize - remainingSize );
+
+    myContent = std::string_view( myBuffer.get(), remainingSize + readSize );
+
+    if ( readSize < myBufferSize - remainingSize )
+    {
+        myIsEndOfFile = true;
+        myError = myFile->getError();
+    }
+
+    return 0 != readSize;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
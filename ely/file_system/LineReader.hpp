@@ -0,0 +1,267 @@
+/*!
+ * \file LineReader.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the LineReader class.
+ */
+#ifndef LINE_READER_HPP
+#define LINE_READER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/File.hpp"
+#include "ely/file_system/MappedFile.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The LineReader class
+ *
+ * Reads the lines of a file, or of a content in memory, as views without allocation.\n\n
+ *
+ * A \c File is read by large blocks in a buffer reused for the whole file : the line
+ * ending a block is moved at the beginning of the buffer before the next block is read,
+ * and the buffer grows if a line is longer than it.\n
+ * A \c MappedFile or a content in memory is not copied, the lines are views on it.\n
+ * The line feeds are found with the vectorized kernels of the \c separators .\n\n
+ *
+ * The lines don't include their line feed, a carriage return before it is kept.
+ * The last line can end without line feed.
+ */
+class LineReader final
+{
+public:
+    class Iterator;
+
+
+    static constexpr std::size_t defaultBufferSize() noexcept;
+
+
+    explicit LineReader( File & file, std::size_t bufferSize = defaultBufferSize() );
+#if defined ( ELY_POSIX_API )
+    explicit LineReader( const MappedFile & file ) noexcept;
+#endif
+    explicit LineReader( std::string_view content ) noexcept;
+
+    LineReader( const LineReader & ) = delete;
+    LineReader & operator =( const LineReader & ) = delete;
+
+
+    bool next( std::string_view & line );
+
+    std::uint64_t getLineNumber() const noexcept;
+    int getError() const noexcept;
+
+
+    Iterator begin();
+    Iterator end() noexcept;
+
+private:
+    bool fill();
+
+
+    File * myFile;
+    std::size_t myBufferSize;
+    std::unique_ptr< char[] > myBuffer;
+    /// The content not read yet, in the buffer or in memory.
+    std::string_view myContent;
+    /// The size of the beginning of the content already scanned for a line feed.
+    std::size_t myScannedSize;
+    bool myIsEndOfFile;
+    std::uint64_t myLineNumber;
+    int myError;
+};
+
+
+/*!
+ * \brief The LineReader::Iterator class
+ *
+ * An input iterator over the lines, a line is valid until the iterator is incremented.
+ */
+class LineReader::Iterator
+{
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef std::string_view value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::string_view * pointer;
+    typedef const std::string_view & reference;
+
+
+    Iterator() noexcept;
+    explicit Iterator( LineReader & reader );
+
+
+    reference operator *() const noexcept;
+    pointer operator ->() const noexcept;
+
+    Iterator & operator ++();
+
+    bool operator ==( const Iterator & iterator ) const noexcept;
+    bool operator !=( const Iterator & iterator ) const noexcept;
+
+private:
+    LineReader * myReader;
+    std::string_view myLine;
+};
+
+
+//
+// LineReader inline functions
+//
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default size of the buffer.
+ */
+constexpr std::size_t LineReader::defaultBufferSize() noexcept
+{
+    return 1024 * 1024;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of lines read.
+ */
+inline std::uint64_t LineReader::getLineNumber() const noexcept
+{
+    return myLineNumber;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The \e errno value of the reading failure, \c 0 if there is none.
+ */
+inline int LineReader::getError() const noexcept
+{
+    return myError;
+}
+
+/*!
+ * \brief Get an iterator on the next line.
+ *
+ * \return An iterator on the next line, equal to \c end() if there is none.
+ */
+inline LineReader::Iterator LineReader::begin()
+{
+    return Iterator( *this );
+}
+
+/*!
+ * \brief Get the end iterator.
+ *
+ * \return The iterator after the last line.
+ */
+inline LineReader::Iterator LineReader::end() noexcept
+{
+    return Iterator();
+}
+
+
+//
+// LineReader::Iterator inline functions
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create an end iterator.
+ */
+inline LineReader::Iterator::Iterator() noexcept
+    : myReader( nullptr ),
+    myLine()
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * Create an iterator on the next line of \p reader .
+ *
+ * \param reader  The reader of the lines.
+ */
+inline LineReader::Iterator::Iterator( LineReader & reader )
+    : myReader( &reader ),
+    myLine()
+{
+    ++*this;
+}
+
+/*!
+ * \brief Dereference operator
+ *
+ * \return The current line.
+ */
+inline LineReader::Iterator::reference LineReader::Iterator::operator *() const noexcept
+{
+    return myLine;
+}
+
+/*!
+ * \brief Dereference operator
+ *
+ * \return A pointer on the current line.
+ */
+inline LineReader::Iterator::pointer LineReader::Iterator::operator ->() const noexcept
+{
+    return &myLine;
+}
+
+/*!
+ * \brief Move to the next line.
+ *
+ * \return A reference on the current object.
+ */
+inline LineReader::Iterator & LineReader::Iterator::operator ++()
+{
+    if ( ! myReader->next( myLine ) )
+    {
+        myReader = nullptr;
+    }
+
+    return *this;
+}
+
+/*!
+ * \brief Comparison operator
+ *
+ * Only the end iterators are equal.
+ *
+ * \return \c true if both iterators are at the same line, \c false otherwise.
+ */
+inline bool LineReader::Iterator::operator ==( const Iterator & iterator ) const noexcept
+{
+    return myReader == iterator.myReader;
+}
+
+/*!
+ * \brief Comparison operator
+ *
+ * \return \c true if the iterators are at different lines, \c false otherwise.
+ */
+inline bool LineReader::Iterator::operator !=( const Iterator & iterator ) const noexcept
+{
+    return ! ( *this == iterator );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // LINE_READER_HPP
@@ -0,0 +1,244 @@
+#include "ely/file_system/MappedFile.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cerrno>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a \c MappedFile to read the file \p filePath and try to map it.
+ *
+ * \param filePath    A \c FilePath object representing the path to the file to map.
+ */
+MappedFile::MappedFile( const FilePath & filePath )
+    : myFilePath( filePath ),
+    myData( nullptr ),
+    mySize( 0 ),
+    myIsMapped( false ),
+    myError( 0 )
+{
+    map();
+}
+
+/*!
+ * \brief Constructor
+ *
+ * Move constructor : Constructs the object with the contents of \p file using the move semantics.\n
+ * \p file is left unmapped.
+ *
+ * \param file    The \c MappedFile object to move.
+ */
+MappedFile::MappedFile( MappedFile && file ) noexcept
+    : myFilePath( std::move( file.myFilePath ) ),
+    myData( std::exchange( file.myData, nullptr ) ),
+    mySize( std::exchange( file.mySize, 0 ) ),
+    myIsMapped( std::exchange( file.myIsMapped, false ) ),
+    myError( file.myError )
+{}
+
+/*!
+ * \brief Destructor
+ *
+ * Unmap the file.
+ */
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+/*!
+ * \brief Move assignment operator
+ *
+ * Unmap the current file and take the mapping of \p file , which is left unmapped.
+ *
+ * \param file    The \c MappedFile object to move.
+ *
+ * \return A reference on the current object.
+ */
+MappedFile & MappedFile::operator =( MappedFile && file ) noexcept
+{
+    if ( this != &file )
+    {
+        unmap();
+
+        myFilePath = std::move( file.myFilePath );
+        myData = std::exchange( file.myData, nullptr );
+        mySize = std::exchange( file.mySize, 0 );
+        myIsMapped = std::exchange( file.myIsMapped, false );
+        myError = file.myError;
+    }
+
+    return *this;
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Map the file.
+ *
+ * The descriptor of the file is closed once mapped.
+ *
+ * \return \c true if the file is mapped, \c false otherwise.
+ *
+ * \sa getError()
+ */
+bool MappedFile::map()
+{
+    if ( isMapped() )
+    {
+        return true;
+    }
+
+    const int descriptor = ::open( std::string( myFilePath.toString() ).c_str(), O_RDONLY | O_CLOEXEC );
+
+    if ( 0 > descriptor )
+    {
+        myError = errno;
+
+        return false;
+    }
+
+    struct stat status;
+
+    if ( 0 != ::fstat( descriptor, &status ) )
+    {
+        myError = errno;
+    }
+    else if ( static_cast< std::uintmax_t >( status.st_size ) > std::numeric_limits< std::size_t >::max() )
+    {
+        // Larger than the address space
+        myError = EFBIG;
+    }
+    else if ( 0 == status.st_size )
+    {
+        // mmap refuses an empty length
+        myError = 0;
+        myIsMapped = true;
+    }
+    else
+    {
+        const std::size_t size = static_cast< std::size_t >( status.st_size );
+        void * data = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+
+        if ( MAP_FAILED == data )
+        {
+            myError = errno;
+        }
+        else
+        {
+            myData = static_cast< const std::byte * >( data );
+            mySize = size;
+            myError = 0;
+            myIsMapped = true;
+        }
+    }
+
+    ::close( descriptor );
+
+    return isMapped();
+}
+
+/*!
+ * \brief Unmap the file.
+ *
+ * The views on the content become invalid.
+ */
+void MappedFile::unmap() noexcept
+{
+    if ( nullptr != myData )
+    {
+        ::munmap( const_cast< std::byte * >( myData ), mySize );
+    }
+
+    myData = nullptr;
+    mySize = 0;
+    myIsMapped = false;
+}
+
+/*!
+ * \brief Tell the kernel how the whole content is going to be read.
+ *
+ * \param advice  How the content is going to be read.
+ *
+ * \return \c true if the advice is taken into account, \c false otherwise.
+ */
+bool MappedFile::advise( Advice advice ) noexcept
+{
+    return advise( advice, 0, mySize );
+}
+
+/*!
+ * \brief Tell the kernel how a part of the content is going to be read.
+ *
+ * The part is extended to the pages containing it and clipped to the content.
+ *
+ * \param advice  How the part is going to be read.
+ * \param offset  The offset of the part in the content.
+ * \param size    The size of the part.
+ *
+ * \return \c true if the advice is taken into account, \c false otherwise.
+ */
+bool MappedFile::advise( Advice advice, std::size_t offset, std::size_t size ) noexcept
+{
+    if ( ! isMapped() )
+    {
+        myError = EBADF;
+
+        return false;
+    }
+
+    if ( offset >= mySize )
+    {
+        return true;
+    }
+
+    size = std::min( size, mySize - offset );
+
+    // madvise requires an address aligned on a page
+    const std::size_t pageSize = static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+    const std::size_t alignedOffset = offset - offset % pageSize;
+    void * address = const_cast< std::byte * >( myData + alignedOffset );
+
+    if ( 0 != ::madvise( address, size + ( offset - alignedOffset ), static_cast< int >( advice ) ) )
+    {
+        myError = errno;
+
+        return false;
+    }
+
+    return true;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
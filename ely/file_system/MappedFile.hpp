@@ -0,0 +1,176 @@
+/*!
+ * \file MappedFile.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for read a file mapped in memory.
+ */
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+
+#include <cstddef>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/FilePath.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <sys/mman.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The MappedFile class
+ *
+ * Maps a whole file read-only in memory with \e mmap .\n\n
+ *
+ * The content is read directly from the page cache, without copy nor system call
+ * for each read, and can be given as a \c std::string_view to the parsers.\n
+ * The kernel can be told how the content will be read with \c advise() .\n
+ * An empty file is mapped without memory : its content is empty and its data is \c nullptr .\n
+ * The mapping stays valid while the file is truncated or rewritten by another process,
+ * reading beyond the new end of the file raises \e SIGBUS .
+ */
+class MappedFile
+{
+public:
+    /// How the content is going to be read.
+    enum class Advice : int
+    {
+        /// No particular order.
+        Normal = MADV_NORMAL,
+        /// Sequentially from the lower to the higher addresses, read ahead aggressively.
+        Sequential = MADV_SEQUENTIAL,
+        /// In random order, don't read ahead.
+        Random = MADV_RANDOM,
+        /// Soon, start reading ahead now.
+        WillNeed = MADV_WILLNEED,
+        /// Not soon, the pages can be released.
+        DontNeed = MADV_DONTNEED
+    };
+
+
+    explicit MappedFile( const FilePath & filePath );
+    MappedFile( MappedFile && file ) noexcept;
+    ~MappedFile();
+
+    MappedFile & operator =( MappedFile && file ) noexcept;
+
+    MappedFile( const MappedFile & ) = delete;
+    MappedFile & operator =( const MappedFile & ) = delete;
+
+
+    bool map();
+    void unmap() noexcept;
+    bool isMapped() const noexcept;
+
+    bool advise( Advice advice ) noexcept;
+    bool advise( Advice advice, std::size_t offset, std::size_t size ) noexcept;
+
+
+    const FilePath & getPath() const noexcept;
+    int getError() const noexcept;
+
+    const std::byte * getData() const noexcept;
+    std::size_t getSize() const noexcept;
+    bool isEmpty() const noexcept;
+    std::string_view getContent() const noexcept;
+
+private:
+    FilePath myFilePath;
+    const std::byte * myData;
+    std::size_t mySize;
+    bool myIsMapped;
+    int myError;
+};
+
+
+/*!
+ * \brief Check if the file is mapped.
+ *
+ * \return \c true if the file is mapped, \c false otherwise.
+ */
+inline bool MappedFile::isMapped() const noexcept
+{
+    return myIsMapped;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return A constant reference on \c FilePath representing the path of the file.
+ */
+inline const FilePath & MappedFile::getPath() const noexcept
+{
+    return myFilePath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The \e errno value of the last failure, \c 0 if there is none.
+ */
+inline int MappedFile::getError() const noexcept
+{
+    return myError;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The first byte of the content, \c nullptr if the file is empty or not mapped.
+ */
+inline const std::byte * MappedFile::getData() const noexcept
+{
+    return myData;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The size of the content in bytes.
+ */
+inline std::size_t MappedFile::getSize() const noexcept
+{
+    return mySize;
+}
+
+/*!
+ * \brief Check if the content is empty.
+ *
+ * \return \c true if the file is empty or not mapped, \c false otherwise.
+ */
+inline bool MappedFile::isEmpty() const noexcept
+{
+    return 0 == mySize;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The content of the file.
+ */
+inline std::string_view MappedFile::getContent() const noexcept
+{
+    return std::string_view( reinterpret_cast< const char * >( myData ), mySize );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // MAPPED_FILE_HPP
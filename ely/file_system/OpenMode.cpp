@@ -0,0 +1,83 @@
+#include "ely/file_system/OpenMode.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <fcntl.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief Get the flags of \e open corresponding to an open mode.
+ *
+ * \c O_CLOEXEC is always set. \c OpenMode::Truncate and \c OpenMode::Append give write access.
+ *
+ * \param mode    The open mode.
+ *
+ * \return The flags.
+ */
+int toOpenFlags( OpenMode mode ) noexcept
+{
+    int flags = O_CLOEXEC;
+
+    // Truncating or appending writes the file
+    if ( hasFlag( mode, OpenMode::Truncate ) || hasFlag( mode, OpenMode::Append ) )
+    {
+        mode = mode | OpenMode::Write;
+    }
+
+    if ( hasFlag( mode, OpenMode::ReadWrite ) )
+    {
+        flags |= O_RDWR;
+    }
+    else if ( hasFlag( mode, OpenMode::Write ) )
+    {
+        flags |= O_WRONLY;
+    }
+    else
+    {
+        flags |= O_RDONLY;
+    }
+
+    if ( hasFlag( mode, OpenMode::Create ) )
+    {
+        flags |= O_CREAT;
+    }
+
+    if ( hasFlag( mode, OpenMode::Exclusive ) )
+    {
+        flags |= O_CREAT | O_EXCL;
+    }
+
+    if ( hasFlag( mode, OpenMode::Truncate ) )
+    {
+        flags |= O_TRUNC;
+    }
+
+    if ( hasFlag( mode, OpenMode::Append ) )
+    {
+        flags |= O_APPEND;
+    }
+
+#if defined ( O_DIRECT )
+    if ( hasFlag( mode, OpenMode::Direct ) )
+    {
+        flags |= O_DIRECT;
+    }
+#endif
+
+    return flags;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,103 @@
+/*!
+ * \file OpenMode.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the OpenMode flags.
+ */
+#ifndef OPEN_MODE_HPP
+#define OPEN_MODE_HPP
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The OpenMode flags
+ *
+ * How a file is opened, the flags are combined with \c | .
+ */
+enum class OpenMode : unsigned
+{
+    /// Read the file.
+    Read = 1 << 0,
+    /// Write the file.
+    Write = 1 << 1,
+    /// Read and write the file.
+    ReadWrite = Read | Write,
+    /// Create the file if it doesn't exist.
+    Create = 1 << 2,
+    /// Empty the file when opening it, implies \c Write .
+    Truncate = 1 << 3,
+    /// Write at the end of the file, whatever the position, implies \c Write .
+    Append = 1 << 4,
+    /// Create the file, fail if it already exists.
+    Exclusive = 1 << 5,
+    /// Transfer the data directly between the buffers and the device, bypassing the page cache.\n
+    /// The buffers, offsets and sizes must be aligned, see \c AlignedBuffer .
+    Direct = 1 << 6
+};
+
+
+/*!
+ * \brief Combine open modes.
+ *
+ * \return The flags of \p left and \p right .
+ */
+constexpr OpenMode operator |( OpenMode left, OpenMode right ) noexcept
+{
+    return static_cast< OpenMode >( static_cast< unsigned >( left ) | static_cast< unsigned >( right ) );
+}
+
+/*!
+ * \brief Intersect open modes.
+ *
+ * \return The flags common to \p left and \p right .
+ */
+constexpr OpenMode operator &( OpenMode left, OpenMode right ) noexcept
+{
+    return static_cast< OpenMode >( static_cast< unsigned >( left ) & static_cast< unsigned >( right ) );
+}
+
+/*!
+ * \brief Remove open modes.
+ *
+ * \return The flags of \p mode without the flags of \p removed .
+ */
+constexpr OpenMode operator -( OpenMode mode, OpenMode removed ) noexcept
+{
+    return static_cast< OpenMode >( static_cast< unsigned >( mode ) & ~static_cast< unsigned >( removed ) );
+}
+
+/*!
+ * \brief Check if a flag is set.
+ *
+ * \param mode    The open mode.
+ * \param flag    The flags to look for.
+ *
+ * \return \c true if every flag of \p flag is in \p mode , \c false otherwise.
+ */
+constexpr bool hasFlag( OpenMode mode, OpenMode flag ) noexcept
+{
+    return ( mode & flag ) == flag;
+}
+
+
+#if defined ( ELY_POSIX_API )
+
+int toOpenFlags( OpenMode mode ) noexcept;
+
+#endif // ELY_POSIX_API
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // OPEN_MODE_HPP
@@ -1,7 +1,12 @@
 #include "ely/file_system/Path.hpp"
 
 
-#include <algorithm>
+#include <cstring>
+
+
+#include "ely/file_system/PathView.hpp"
+#include "ely/file_system/normalization.hpp"
+#include "ely/file_system/separators.hpp"
 
 
 namespace ely
@@ -27,30 +32,7 @@ namespace file_system
  */
 std::string Path::dirName( std::string pathString )
 {
-    if ( ! pathString.empty() )
-    {
-        stripLastSeparator( pathString );
-
-        std::string::size_type lastSeparatorPosition = pathString.find_last_of( standardSeparator() );
-
-        if ( std::string::npos != lastSeparatorPosition ) // last separator found
-        {
-            if ( 0 == lastSeparatorPosition )
-            {
-                pathString = standardSeparator();
-            }
-            else
-            {
-                pathString = pathString.substr( 0, lastSeparatorPosition );
-            }
-        }
-        else if ( parentDirectory() != pathString )
-        {
-            pathString = currentDirectory();
-        }
-    }
-
-    return pathString;
+    return std::string( PathView( fromSystemSeparator( pathString ) ).dirName() );
 }
 
 /*!
@@ -66,37 +48,7 @@ std::string Path::dirName( std::string pathString )
  */
 std::string Path::baseName( std::string pathString, const std::string & suffix )
 {
-    std::string baseNameReturned;
-
-    if ( ! pathString.empty() )
-    {
-        stripLastSeparator( pathString );
-
-        std::string::size_type from = pathString.find_last_of( standardSeparator() );
-
-        if ( std::string::npos != from && pathString.size() > 1 ) // last separator found
-        {
-            ++from;
-        }
-        else // If there is no access path or it's the unix root directory '/'
-        {
-            from = 0;
-        }
-
-        std::string::size_type to = pathString.length();
-
-        if ( ! suffix.empty() )
-        {
-            if ( suffix == pathString.substr( pathString.length() - suffix.length() ) ) // pathString ends with suffix
-            {
-                to -= suffix.length();
-            }
-        }
-
-        baseNameReturned = std::string( pathString, from, to - from );
-    }
-
-    return baseNameReturned;
+    return std::string( PathView( fromSystemSeparator( pathString ) ).baseName( suffix ) );
 }
 
 /*!
@@ -153,7 +105,7 @@ std::string & Path::fromSystemSeparator( std::string & pathString )
 {
     if ( systemSeparator() != standardSeparator() )
     {
-        std::replace( pathString.begin(), pathString.end(), systemSeparator(), standardSeparator() );
+        separators::replace( pathString.data(), pathString.size(), systemSeparator(), standardSeparator() );
     }
 
     return pathString;
@@ -191,7 +143,7 @@ std::string & Path::toSystemSeparator( std::string & pathString )
 {
     if ( systemSeparator() != standardSeparator() )
     {
-        std::replace( pathString.begin(), pathString.end(), standardSeparator(), systemSeparator() );
+        separators::replace( pathString.data(), pathString.size(), standardSeparator(), systemSeparator() );
     }
 
     return pathString;
@@ -229,8 +181,10 @@ std::string Path::toSystemSeparator( const std::string & pathString )
  * \sa Path( Path && )
  */
 Path::Path() noexcept
-    : myAccessPath( currentDirectory() ),
-    myName( currentDirectory() )
+    : myPath( currentDirectory() ),
+    myAccessPathSize( myPath.size() ),
+    myNameOffset( 0 ),
+    myHash( computeHash( myPath ) )
 {}
 
 /*!
@@ -245,9 +199,13 @@ Path::Path() noexcept
  * \sa Path( Path && )
  */
 Path::Path( const std::string & pathString )
-    : myAccessPath( dirName( pathString ) ),
-    myName( baseName( pathString ) )
-{}
+    : myPath(),
+    myAccessPathSize( 0 ),
+    myNameOffset( 0 ),
+    myHash( 0 )
+{
+    parse( pathString );
+}
 
 /*!
  * \brief Constructor
@@ -261,8 +219,10 @@ Path::Path( const std::string & pathString )
  * \sa Path( Path && )
  */
 Path::Path( const Path & path ) noexcept
-    : myAccessPath( path.myAccessPath ),
-    myName( path.myName )
+    : myPath( path.myPath ),
+    myAccessPathSize( path.myAccessPathSize ),
+    myNameOffset( path.myNameOffset ),
+    myHash( path.myHash )
 {}
 
 /*!
@@ -270,7 +230,7 @@ Path::Path( const Path & path ) noexcept
  *
  * Move constructor : Constructs the object with the contents of \p path
  * using the move semantics.\n
- * \p path is left valid but unspecified state.
+ * \p path is left empty.
  *
  * \param path  The \c Path object to move.
  *
@@ -279,9 +239,16 @@ Path::Path( const Path & path ) noexcept
  * \sa Path( Path && )
  */
 Path::Path( Path && path ) noexcept
-    : myAccessPath( std::move( path.myAccessPath ) ),
-    myName( std::move( path.myName ) )
-{}
+    : myPath( std::move( path.myPath ) ),
+    myAccessPathSize( path.myAccessPathSize ),
+    myNameOffset( path.myNameOffset ),
+    myHash( path.myHash )
+{
+    path.myPath.clear();
+    path.myAccessPathSize = 0;
+    path.myNameOffset = 0;
+    path.myHash = computeHash( path.myPath );
+}
 
 /*!
  * \brief Assignment operator
@@ -299,8 +266,7 @@ Path & Path::operator =( const std::string & pathString ) noexcept
 {
     try
     {
-        myAccessPath = dirName( pathString );
-        myName = baseName( pathString );
+        parse( pathString );
     }
     catch ( ... )
     {
@@ -325,8 +291,10 @@ Path & Path::operator =( const std::string & pathString ) noexcept
  */
 Path & Path::operator =( const Path & path ) noexcept
 {
-    myAccessPath = path.myAccessPath;
-    myName = path.myName;
+    myPath = path.myPath;
+    myAccessPathSize = path.myAccessPathSize;
+    myNameOffset = path.myNameOffset;
+    myHash = path.myHash;
 
     return *this;
 }
@@ -334,7 +302,8 @@ Path & Path::operator =( const Path & path ) noexcept
 /*!
  * \brief Assignment operator
  *
- * Move the contents of \p path using the move semantics.
+ * Move the contents of \p path using the move semantics.\n
+ * \p path is left empty.
  *
  * \param path  The \c Path object to move.
  *
@@ -345,8 +314,18 @@ Path & Path::operator =( const Path & path ) noexcept
  */
 Path & Path::operator =( Path && path ) noexcept
 {
-    myAccessPath = std::move( path.myAccessPath );
-    myName = std::move( path.myName );
+    if ( this != &path )
+    {
+        myPath = std::move( path.myPath );
+        myAccessPathSize = path.myAccessPathSize;
+        myNameOffset = path.myNameOffset;
+        myHash = path.myHash;
+
+        path.myPath.clear();
+        path.myAccessPathSize = 0;
+        path.myNameOffset = 0;
+        path.myHash = computeHash( path.myPath );
+    }
 
     return *this;
 }
@@ -357,28 +336,109 @@ Path & Path::operator =( Path && path ) noexcept
 //
 
 /*!
- * \brief Convert an \c Path object to a string
+ * \brief Normalize the path.
+ *
+ * Removes the \e . components and the duplicate separators and collapses the \e .. components,
+ * without accessing the file system.\n
+ * The path is normalized in its own buffer.
  *
- * \return The path to the file manage by the object.
+ * \sa normalizeInPlace()
  */
-std::string Path::toString() const
+void Path::normalize()
 {
-    return ( getAccessPath() == getName() ) ? getAccessPath() : getAccessPath() + standardSeparator() + getName();
+    std::string path( std::move( myPath ) );
+
+    path.resize( normalizeInPlace( path.data(), path.size() ) );
+    parse( std::move( path ) );
 }
 
 
 //
-// Accessors
+// External functions
 //
 
 /*!
- * \brief Accessor
+ * \brief Compare two paths.
+ *
+ * The normalized comparison doesn't allocate for the paths shorter than
+ * \c NormalizedPathView::inlineCapacity() .
+ *
+ * \param first       The first path to compare.
+ * \param second      The second path to compare with.
+ * \param comparison  How to compare the paths.
+ *
+ * \return \c true if the paths are equal, \c false otherwise.
  *
- * \return The name of the path's target.
+ * \sa operator ==( const Path &, const Path & )
  */
-std::string Path::getName() const noexcept
+bool isEqual( const Path & first, const Path & second, PathComparison comparison )
 {
-    return myName;
+    if ( PathComparison::Exact == comparison )
+    {
+        return first == second;
+    }
+
+    return NormalizedPathView( first.toString() ).toString() == NormalizedPathView( second.toString() ).toString();
+}
+
+/*!
+ * \brief Join operator
+ *
+ * \param path    The path to join to.
+ * \param part    The path to join with \p path , replaces it if it's absolute.
+ *
+ * \return The joined path.
+ *
+ * \sa Path::join()
+ */
+Path operator +( const Path & path, std::string_view part )
+{
+    return Path::join( path, part );
+}
+
+/*!
+ * \brief Join operator
+ *
+ * \param path    The path to join to.
+ * \param part    The path to join with \p path , replaces it if it's absolute.
+ *
+ * \return The joined path.
+ *
+ * \sa Path::join()
+ */
+Path operator +( const Path & path, const std::string & part )
+{
+    return Path::join( path, part );
+}
+
+/*!
+ * \brief Join operator
+ *
+ * \param path    The path to join to.
+ * \param part    The path to join with \p path , replaces it if it's absolute.
+ *
+ * \return The joined path.
+ *
+ * \sa Path::join()
+ */
+Path operator +( const Path & path, const char * part )
+{
+    return Path::join( path, part );
+}
+
+/*!
+ * \brief Join operator
+ *
+ * \param first   The path to join to.
+ * \param second  The path to join with \p first , replaces it if it's absolute.
+ *
+ * \return The joined path.
+ *
+ * \sa Path::join()
+ */
+Path operator +( const Path & first, const Path & second )
+{
+    return Path::join( first, second );
 }
 
 
@@ -397,5 +457,212 @@ Path::Clone Path::doClone() const
 }
 
 
+//
+// Private static functions
+//
+
+/*!
+ * \brief Check if a path is its own access path.
+ *
+ * It's the case of the root directory, the current directory,
+ * the parent directory and of the empty path.
+ *
+ * \param pathString  The path, in the standard format and without its last separator.
+ *
+ * \return \c true if the access path and the name of \p pathString are \p pathString itself, \c false otherwise.
+ */
+bool Path::isOwnAccessPath( std::string_view pathString ) noexcept
+{
+    return pathString.empty() ||
+           ( 1 == pathString.size() && standardSeparator() == pathString.front() ) ||
+           currentDirectory() == pathString ||
+           parentDirectory() == pathString;
+}
+
+
+/*!
+ * \brief Hash a path.
+ *
+ * Hashes 8 characters at once with the mix of MurmurHash64A.
+ *
+ * \param pathString  The path to hash.
+ *
+ * \return The 64 bits hash of \p pathString .
+ */
+std::uint64_t Path::computeHash( std::string_view pathString ) noexcept
+{
+    const std::uint64_t multiplier = 0xc6a4a7935bd1e995ull;
+    const int shift = 47;
+    const std::size_t blocksSize = pathString.size() - pathString.size() % 8;
+
+    std::uint64_t hash = 0x9E3779B97F4A7C15ull ^ ( pathString.size() * multiplier );
+
+    for ( std::size_t i = 0; i < blocksSize; i += 8 )
+    {
+        std::uint64_t block;
+
+        std::memcpy( &block, pathString.data() + i, sizeof( block ) );
+
+        block *= multiplier;
+        block ^= block >> shift;
+        block *= multiplier;
+
+        hash ^= block;
+        hash *= multiplier;
+    }
+
+    if ( blocksSize < pathString.size() )
+    {
+        std::uint64_t block = 0;
+
+        for ( std::size_t i = pathString.size(); blocksSize < i; --i )
+        {
+            block = ( block << 8 ) | static_cast< unsigned char >( pathString[ i - 1 ] );
+        }
+
+        hash ^= block;
+        hash *= multiplier;
+    }
+
+    hash ^= hash >> shift;
+    hash *= multiplier;
+    hash ^= hash >> shift;
+
+    return hash;
+}
+
+
+/*!
+ * \brief Join paths in a string.
+ *
+ * \param pathString  The string receiving the joined path.
+ * \param parts       The paths to join.
+ * \param count       The number of paths in \p parts .
+ *
+ * \return A reference on \p pathString .
+ *
+ * \sa join()
+ */
+std::string & Path::joinParts( std::string & pathString, const std::string_view * parts, std::size_t count )
+{
+    const auto isAbsolute = [] ( std::string_view part ) noexcept
+    {
+        return ! part.empty() && ( standardSeparator() == part.front() || systemSeparator() == part.front() );
+    };
+
+    // An absolute part replaces the parts before it
+    std::size_t first = 0;
+    std::size_t size = 0;
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        if ( isAbsolute( parts[ i ] ) )
+        {
+            first = i;
+            size = 0;
+        }
+
+        size += parts[ i ].size() + 1;
+    }
+
+    pathString.clear();
+    pathString.reserve( size );
+
+    for ( std::size_t i = first; i < count; ++i )
+    {
+        const std::string_view part = parts[ i ];
+
+        if ( part.empty() )
+        {
+            continue;
+        }
+
+        if ( ! pathString.empty() && standardSeparator() != pathString.back() && systemSeparator() != pathString.back() )
+        {
+            pathString += standardSeparator();
+        }
+
+        pathString.append( part.data(), part.size() );
+    }
+
+    return pathString;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Replace the path currently manage by \p pathString.
+ *
+ * Splits \p pathString like \c dirName() and \c baseName() but keeps it in a single string.
+ *
+ * \param pathString  The new path to manage.
+ */
+void Path::parse( std::string pathString )
+{
+    std::string path( std::move( stripLastSeparator( pathString ) ) );
+    const std::string::size_type lastSeparatorPosition = separators::findLast( path, standardSeparator(), standardSeparator() );
+
+    if ( isOwnAccessPath( path ) )
+    {
+        myAccessPathSize = path.size();
+        myNameOffset = 0;
+        myPath = std::move( path );
+        myHash = computeHash( myPath );
+    }
+    else if ( std::string::npos == lastSeparatorPosition )
+    {
+        assign( currentDirectory(), path );
+    }
+    else
+    {
+        // The separator is kept in the access path only for the root directory
+        myAccessPathSize = ( 0 == lastSeparatorPosition ) ? 1 : lastSeparatorPosition;
+        myNameOffset = lastSeparatorPosition + 1;
+        myPath = std::move( path );
+        myHash = computeHash( myPath );
+    }
+}
+
+/*!
+ * \brief Replace the path currently manage by \p accessPath followed by \p name.
+ *
+ * \param accessPath  The new access path, in the standard format and without its last separator.
+ * \param name        The new name, in the standard format and without its last separator.
+ */
+void Path::assign( std::string_view accessPath, std::string_view name )
+{
+    std::string path;
+    std::string::size_type nameOffset = 0;
+
+    if ( accessPath == name && isOwnAccessPath( name ) )
+    {
+        path = name;
+    }
+    else
+    {
+        path.reserve( accessPath.size() + 1 + name.size() );
+        path = accessPath;
+
+        // The root directory already ends with a separator
+        if ( path.empty() || standardSeparator() != path.back() )
+        {
+            path += standardSeparator();
+        }
+
+        nameOffset = path.size();
+        path += name;
+    }
+
+    // The views may point to the current path, it's replaced last
+    myPath = std::move( path );
+    myAccessPathSize = accessPath.size();
+    myNameOffset = nameOffset;
+    myHash = computeHash( myPath );
+}
+
+
 } // namespace ::ely::file_system
 } // namespace ::ely
@@ -9,7 +9,11 @@
 #define PATH_H
 
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 
 
 #include "ely/config.hpp"
@@ -22,6 +26,16 @@ namespace file_system
 {
 
 
+/// The ways to compare two paths.
+enum class PathComparison
+{
+    /// The paths are compared as they are stored.
+    Exact,
+    /// The normalized forms of the paths are compared.
+    Normalized
+};
+
+
 /*!
  * \brief The Path class
  *
@@ -33,7 +47,11 @@ namespace file_system
  * A path is composed of its access path (its location) and its name.\n
  * Exemple : \e /home/ely/script.sh\n
  * \e /home/ely is the access path.\n
- * \e script.sh is the name.
+ * \e script.sh is the name.\n\n
+ *
+ * The whole path is kept in a single string, the access path and the name are
+ * ranges of it : the accessors return views without copying anything.\n
+ * A view stays valid until the path is modified or destroyed.
  */
 class Path : public patterns::AbstractCloneable< Path >
 {
@@ -63,20 +81,31 @@ public:
 
 
     void print( std::ostream & os ) const;
-    virtual std::string toString() const;
+    std::string_view toString() const noexcept;
+
+    void normalize();
+
+    std::uint64_t getHash() const noexcept;
 
 
-    std::string getAccessPath() const noexcept;
+    std::string_view getAccessPath() const noexcept;
     void setAccessPath( const std::string & accessPath );
 
-    virtual std::string getName() const noexcept;
-    void setName( const std::string & name );
+    std::string_view getName() const noexcept;
+    virtual void setName( const std::string & name );
 
 
-    // TODO : add operator +(Path, string) => Path + separator + string
-    //                      (Path, Path) => Path + separator + Path ?
+    template < typename ... Parts >
+    static Path join( const Parts & ... parts );
+    template < typename ... Parts >
+    static std::string & joinTo( std::string & pathString, const Parts & ... parts );
 
 protected:
+    friend class PathTable;
+    friend class PathView;
+    friend std::size_t normalizeInPlace( char * pathString, std::size_t size ) noexcept;
+
+
     static constexpr char systemSeparator() noexcept;
     static constexpr char standardSeparator() noexcept;
     static const std::string currentDirectory() noexcept;
@@ -85,9 +114,24 @@ protected:
 
     Clone doClone() const override;
 
+private:
+    static bool isOwnAccessPath( std::string_view pathString ) noexcept;
+    static std::uint64_t computeHash( std::string_view pathString ) noexcept;
+    static std::string & joinParts( std::string & pathString, const std::string_view * parts, std::size_t count );
+
 
-    std::string myAccessPath;
-    std::string myName;
+    void parse( std::string pathString );
+    void assign( std::string_view accessPath, std::string_view name );
+
+
+    /// The whole path, in the standard format.
+    std::string myPath;
+    /// The access path is the beginning of \c myPath .
+    std::string::size_type myAccessPathSize;
+    /// The name is the end of \c myPath .
+    std::string::size_type myNameOffset;
+    /// The hash of \c myPath , updated with it.
+    std::uint64_t myHash;
 };
 
 //
@@ -123,14 +167,24 @@ inline std::ostream & operator <<( std::ostream & os, const Path & abstractPath
  * \param first     The first object to compare.
  * \param second    The second object to compare with.
  *
+ * The paths are compared only if their hashes are equal.
+ *
  * \return \c true if they represent the same file, \c false otherwise.
  */
 inline bool operator ==( const Path & first, const Path & second ) noexcept
 {
-    return first.getAccessPath() == second.getAccessPath() &&
+    return first.getHash() == second.getHash() &&
+           first.getAccessPath() == second.getAccessPath() &&
            first.getName() == second.getName();
 }
 
+bool isEqual( const Path & first, const Path & second, PathComparison comparison = PathComparison::Exact );
+
+Path operator +( const Path & path, std::string_view part );
+Path operator +( const Path & path, const std::string & part );
+Path operator +( const Path & path, const char * part );
+Path operator +( const Path & first, const Path & second );
+
 
 //
 // Public inline functions
@@ -151,6 +205,28 @@ inline void Path::print( std::ostream & os ) const
     os << toString();
 }
 
+/*!
+ * \brief Convert an \c Path object to a string
+ *
+ * \return The path to the file manage by the object.
+ */
+inline std::string_view Path::toString() const noexcept
+{
+    return myPath;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * The hash is computed when the path is modified.
+ *
+ * \return The 64 bits hash of the path.
+ */
+inline std::uint64_t Path::getHash() const noexcept
+{
+    return myHash;
+}
+
 
 //
 // Accessors
@@ -161,9 +237,9 @@ inline void Path::print( std::ostream & os ) const
  *
  * \return The access path.
  */
-inline std::string Path::getAccessPath() const noexcept
+inline std::string_view Path::getAccessPath() const noexcept
 {
-    return myAccessPath;
+    return std::string_view( myPath.data(), myAccessPathSize );
 }
 /*!
  * \brief Accessor
@@ -179,19 +255,29 @@ inline std::string Path::getAccessPath() const noexcept
  */
 inline void Path::setAccessPath( const std::string & accessPath )
 {
-    myAccessPath = stripLastSeparator( accessPath );
+    assign( stripLastSeparator( accessPath ), getName() );
 }
 
+/*!
+ * \brief Accessor
+ *
+ * \return The name of the path's target.
+ */
+inline std::string_view Path::getName() const noexcept
+{
+    return std::string_view( myPath ).substr( myNameOffset );
+}
 /*!
  * \brief Accessor
  *
  * Replace the actual name with \p name.\n
+ * Virtual, so a \c FilePath keeps its extension through a reference on \c Path .
  *
  * \param name The new name of the path's target.
  */
 inline void Path::setName( const std::string & name )
 {
-    myName = stripLastSeparator( name );
+    assign( getAccessPath(), stripLastSeparator( name ) );
 }
 
 
@@ -257,4 +343,29 @@ inline const std::string Path::parentDirectory() noexcept
 } // namespace ::ely::file_system
 } // namespace ::ely
 
+
+#include "ely/file_system/Path.tpp"
+
+
+namespace std
+{
+
+
+/*!
+ * \brief Specialization of hash
+ *
+ * Uses the hash cached by the path.
+ */
+template <>
+struct hash< ::ely::file_system::Path >
+{
+    size_t operator ()( const ::ely::file_system::Path & path ) const noexcept
+    {
+        return static_cast< size_t >( path.getHash() );
+    }
+};
+
+
+} // namespace ::std
+
 #endif // PATH_H
@@ -0,0 +1,106 @@
+/*!
+ * \file Path.tpp
+ *
+ * \author Ely
+ *
+ * \brief Source file of the templates of the Path class.
+ */
+namespace ely
+{
+namespace file_system
+{
+namespace detail
+{
+
+
+/*!
+ * \brief Get the string of a part of a path to join.
+ */
+inline std::string_view toPathPart( std::string_view part ) noexcept
+{
+    return part;
+}
+
+/*!
+ * \brief Get the string of a part of a path to join.
+ */
+inline std::string_view toPathPart( const std::string & part ) noexcept
+{
+    return part;
+}
+
+/*!
+ * \brief Get the string of a part of a path to join.
+ */
+inline std::string_view toPathPart( const char * part ) noexcept
+{
+    return part;
+}
+
+/*!
+ * \brief Get the string of a part of a path to join.
+ */
+inline std::string_view toPathPart( const Path & part ) noexcept
+{
+    return part.toString();
+}
+
+
+} // namespace ::ely::file_system::detail
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Parts >
+/*!
+ * \brief Join paths.
+ *
+ * The parts are separated by a single separator, the empty parts are skipped
+ * and an absolute part replaces the parts before it.\n
+ * Exemple : \e join( "/home", "ely/", "script.sh" ) gives \e /home/ely/script.sh .\n
+ * The size of the result is computed first so it's allocated once.
+ *
+ * \param parts   The paths to join : \c Path objects or strings.
+ *
+ * \return The joined path.
+ *
+ * \sa joinTo()
+ */
+Path Path::join( const Parts & ... parts )
+{
+    std::string pathString;
+    Path path;
+
+    path.parse( std::move( joinTo( pathString, parts ... ) ) );
+
+    return path;
+}
+
+template < typename ... Parts >
+/*!
+ * \brief Join paths in a string.
+ *
+ * Replaces the content of \p pathString , reusing its capacity.
+ *
+ * \param pathString  The string receiving the joined path.
+ * \param parts       The paths to join : \c Path objects or strings.
+ *
+ * \return A reference on \p pathString .
+ *
+ * \sa join()
+ */
+std::string & Path::joinTo( std::string & pathString, const Parts & ... parts )
+{
+    // The first empty part avoids an empty array
+    const std::string_view views[] = { std::string_view(), detail::toPathPart( parts ) ... };
+
+    return joinParts( pathString, views, sizeof( views ) / sizeof( views[ 0 ] ) );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
@@ -0,0 +1,330 @@
+#include "ely/file_system/PathTable.hpp"
+
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+
+#include "ely/file_system/PathView.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a table containing only the empty path.
+ */
+PathTable::PathTable()
+    : myNodes( 1, Node { invalidId(), 0, 0, 0 } ),
+    myNames(),
+    mySlots( 16, invalidId() )
+{}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Intern a path.
+ *
+ * Adds the components of \p pathString missing from the trie.
+ *
+ * \param pathString  The path to intern.
+ *
+ * \return The id of the path.
+ *
+ * \throw std::length_error If the table can't hold more entries or names.
+ */
+PathTable::Id PathTable::intern( std::string_view pathString )
+{
+    Id id = emptyPathId();
+
+    for ( std::string_view component : PathView( pathString ) )
+    {
+        id = internChild( id, component );
+    }
+
+    return id;
+}
+
+/*!
+ * \brief Find an interned path.
+ *
+ * \param pathString  The path to look for.
+ *
+ * \return The id of the path, \c invalidId() if it was not interned.
+ */
+PathTable::Id PathTable::find( std::string_view pathString ) const noexcept
+{
+    Id id = emptyPathId();
+
+    for ( std::string_view component : PathView( pathString ) )
+    {
+        id = findChild( id, component );
+
+        if ( invalidId() == id )
+        {
+            break;
+        }
+    }
+
+    return id;
+}
+
+/*!
+ * \brief Convert an interned path to a string.
+ *
+ * \param id  The id of an interned path.
+ *
+ * \return The path, with the standard separator.
+ */
+std::string PathTable::toString( Id id ) const
+{
+    std::string pathString;
+
+    appendTo( id, pathString );
+
+    return pathString;
+}
+
+/*!
+ * \brief Append an interned path to a string.
+ *
+ * The string is grown at most once.
+ *
+ * \param id          The id of an interned path.
+ * \param pathString  The string to append the path to.
+ */
+void PathTable::appendTo( Id id, std::string & pathString ) const
+{
+    SizeType size = 0;
+
+    for ( Id current = id; emptyPathId() != current; current = getParent( current ) )
+    {
+        size += myNodes[ current ].nameSize + ( hasSeparatorBefore( current ) ? 1 : 0 );
+    }
+
+    // The components are written from the last one
+    SizeType position = pathString.size() + size;
+
+    pathString.resize( position );
+
+    for ( Id current = id; emptyPathId() != current; current = getParent( current ) )
+    {
+        const std::string_view name = getName( current );
+
+        position -= name.size();
+        pathString.replace( position, name.size(), name.data(), name.size() );
+
+        if ( hasSeparatorBefore( current ) )
+        {
+            pathString[ --position ] = Path::standardSeparator();
+        }
+    }
+}
+
+/*!
+ * \brief Convert an interned path to a \c Path object.
+ *
+ * \param id  The id of an interned path.
+ *
+ * \return The path.
+ */
+Path PathTable::toPath( Id id ) const
+{
+    return Path( toString( id ) );
+}
+
+/*!
+ * \brief Prepare the table for \p size entries.
+ *
+ * \param size    The expected number of entries.
+ */
+void PathTable::reserve( SizeType size )
+{
+    myNodes.reserve( size );
+
+    SizeType slotCount = mySlots.size();
+
+    while ( slotCount / 2 < size )
+    {
+        slotCount *= 2;
+    }
+
+    if ( slotCount != mySlots.size() )
+    {
+        rehash( slotCount );
+    }
+}
+
+
+//
+// Private static functions
+//
+
+/*!
+ * \brief Hash an entry.
+ *
+ * \param parent  The id of the entry's parent.
+ * \param name    The name of the entry.
+ *
+ * \return The hash of the entry.
+ */
+std::uint32_t PathTable::hash( Id parent, std::string_view name ) noexcept
+{
+    std::uint64_t value = std::hash< std::string_view >()( name );
+
+    value ^= ( static_cast< std::uint64_t >( parent ) + 1 ) * 0x9E3779B97F4A7C15ull;
+    value ^= value >> 32;
+
+    return static_cast< std::uint32_t >( value );
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Intern a component.
+ *
+ * \param parent  The id of the component's access path.
+ * \param name    The component.
+ *
+ * \return The id of the component.
+ *
+ * \throw std::length_error If the table can't hold more entries or names.
+ */
+PathTable::Id PathTable::internChild( Id parent, std::string_view name )
+{
+    const std::uint32_t childHash = hash( parent, name );
+    SizeType slot = findSlot( parent, name, childHash );
+
+    if ( invalidId() != mySlots[ slot ] )
+    {
+        return mySlots[ slot ];
+    }
+
+    if ( invalidId() - 1 <= myNodes.size() ||
+         std::numeric_limits< std::uint32_t >::max() - myNames.size() < name.size() )
+    {
+        throw std::length_error( "PathTable::internChild : too many paths" );
+    }
+
+    // Keeps the load factor under one half
+    if ( mySlots.size() / 2 <= myNodes.size() )
+    {
+        rehash( mySlots.size() * 2 );
+        slot = findSlot( parent, name, childHash );
+    }
+
+    const Id id = static_cast< Id >( myNodes.size() );
+
+    myNodes.push_back( Node { parent,
+                              static_cast< std::uint32_t >( myNames.size() ),
+                              static_cast< std::uint32_t >( name.size() ),
+                              childHash } );
+    myNames.append( name.data(), name.size() );
+    mySlots[ slot ] = id;
+
+    return id;
+}
+
+/*!
+ * \brief Find a component.
+ *
+ * \param parent  The id of the component's access path.
+ * \param name    The component.
+ *
+ * \return The id of the component, \c invalidId() if it was not interned.
+ */
+PathTable::Id PathTable::findChild( Id parent, std::string_view name ) const noexcept
+{
+    return mySlots[ findSlot( parent, name, hash( parent, name ) ) ];
+}
+
+/*!
+ * \brief Find the slot of an entry.
+ *
+ * \param parent      The id of the entry's parent.
+ * \param name        The name of the entry.
+ * \param entryHash   The hash of the entry.
+ *
+ * \return The slot containing the entry, or the empty slot where to insert it.
+ */
+PathTable::SizeType PathTable::findSlot( Id parent, std::string_view name, std::uint32_t entryHash ) const noexcept
+{
+    const SizeType mask = mySlots.size() - 1;
+
+    for ( SizeType slot = entryHash & mask; ; slot = ( slot + 1 ) & mask )
+    {
+        const Id id = mySlots[ slot ];
+
+        if ( invalidId() == id )
+        {
+            return slot;
+        }
+
+        const Node & node = myNodes[ id ];
+
+        if ( entryHash == node.hash && parent == node.parent && name == getName( id ) )
+        {
+            return slot;
+        }
+    }
+}
+
+/*!
+ * \brief Rebuild the hash table.
+ *
+ * \param slotCount   The new number of slots, a power of two.
+ */
+void PathTable::rehash( SizeType slotCount )
+{
+    std::vector< Id > slots( slotCount, invalidId() );
+    const SizeType mask = slotCount - 1;
+
+    // The empty path is not in the hash table
+    for ( Id id = 1; id < myNodes.size(); ++id )
+    {
+        SizeType slot = myNodes[ id ].hash & mask;
+
+        while ( invalidId() != slots[ slot ] )
+        {
+            slot = ( slot + 1 ) & mask;
+        }
+
+        slots[ slot ] = id;
+    }
+
+    mySlots.swap( slots );
+}
+
+/*!
+ * \brief Check if a separator is written before a component.
+ *
+ * \param id  The id of the component.
+ *
+ * \return \c true if the component has an access path which is not the root directory, \c false otherwise.
+ */
+bool PathTable::hasSeparatorBefore( Id id ) const noexcept
+{
+    const Id parent = getParent( id );
+
+    return emptyPathId() != parent && Path::standardSeparator() != myNames[ myNodes[ parent ].nameOffset ];
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
@@ -0,0 +1,172 @@
+/*!
+ * \file PathTable.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for store many paths sharing their directories.
+ */
+#ifndef PATH_TABLE_HPP
+#define PATH_TABLE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/Path.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The PathTable class
+ *
+ * Interns paths in a trie of their components : the paths under the same directory
+ * share the storage of that directory, each component is stored only once per
+ * directory.\n
+ * A path is identified by a 32 bits \c Id and converted back to a string on demand.\n\n
+ *
+ * Each entry of the trie costs a few integers : the names are packed in a single
+ * buffer and the children of every directory are found through a single open
+ * addressing hash table keyed by the parent's id and the name.\n\n
+ *
+ * The paths are interned as given, they are not normalized.\n
+ * The class is not thread safe.
+ *
+ * \sa PathView
+ */
+class PathTable
+{
+public:
+    /// The identifier of an interned path.
+    typedef std::uint32_t Id;
+    /// The type of the sizes.
+    typedef std::size_t SizeType;
+
+
+    static constexpr Id emptyPathId() noexcept;
+    static constexpr Id invalidId() noexcept;
+
+
+    PathTable();
+
+
+    Id intern( std::string_view pathString );
+    Id find( std::string_view pathString ) const noexcept;
+
+    Id getParent( Id id ) const noexcept;
+    std::string_view getName( Id id ) const noexcept;
+
+    std::string toString( Id id ) const;
+    void appendTo( Id id, std::string & pathString ) const;
+    Path toPath( Id id ) const;
+
+    SizeType getSize() const noexcept;
+    void reserve( SizeType size );
+
+private:
+    /// An entry of the trie.
+    struct Node
+    {
+        Id parent;
+        std::uint32_t nameOffset;
+        std::uint32_t nameSize;
+        std::uint32_t hash;
+    };
+
+
+    static std::uint32_t hash( Id parent, std::string_view name ) noexcept;
+
+
+    Id internChild( Id parent, std::string_view name );
+    Id findChild( Id parent, std::string_view name ) const noexcept;
+    SizeType findSlot( Id parent, std::string_view name, std::uint32_t hash ) const noexcept;
+    void rehash( SizeType slotCount );
+    bool hasSeparatorBefore( Id id ) const noexcept;
+
+
+    /// The entries, indexed by their id.
+    std::vector< Node > myNodes;
+    /// The names of all the entries, one after the other.
+    std::string myNames;
+    /// The ids of the entries, indexed by the hash of their parent and name.
+    std::vector< Id > mySlots;
+};
+
+
+//
+// Public static inline functions
+//
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The id of the empty path, the parent of the first component of every path.
+ */
+constexpr PathTable::Id PathTable::emptyPathId() noexcept
+{
+    return 0;
+}
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The id returned when a path is not found.
+ */
+constexpr PathTable::Id PathTable::invalidId() noexcept
+{
+    return static_cast< Id >( -1 );
+}
+
+
+//
+// Accessors
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \param id  The id of an interned path.
+ *
+ * \return The id of the path's access path, \c invalidId() for the empty path.
+ */
+inline PathTable::Id PathTable::getParent( Id id ) const noexcept
+{
+    return myNodes[ id ].parent;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \param id  The id of an interned path.
+ *
+ * \return The last component of the path, valid until the next path is interned.
+ */
+inline std::string_view PathTable::getName( Id id ) const noexcept
+{
+    return std::string_view( myNames ).substr( myNodes[ id ].nameOffset, myNodes[ id ].nameSize );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of entries in the trie, including the empty path.
+ */
+inline PathTable::SizeType PathTable::getSize() const noexcept
+{
+    return myNodes.size();
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+#endif // PATH_TABLE_HPP
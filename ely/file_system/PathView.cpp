@@ -0,0 +1,216 @@
+#include "ely/file_system/PathView.hpp"
+
+
+#include <algorithm>
+
+
+#include "ely/file_system/separators.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Get the access path.
+ *
+ * \return The access path of the parsed path, or \e . if it contains no separators.
+ *
+ * \sa Path::dirName( std::string )
+ */
+std::string_view PathView::dirName() const noexcept
+{
+    if ( myPath.empty() )
+    {
+        return myPath;
+    }
+
+    const std::string_view pathString = stripLastSeparator();
+    const std::string_view::size_type lastSeparatorPosition = findLastSeparator( pathString );
+
+    if ( std::string_view::npos != lastSeparatorPosition ) // last separator found
+    {
+        // Keeps the separator only for the root directory
+        return pathString.substr( 0, ( 0 == lastSeparatorPosition ) ? 1 : lastSeparatorPosition );
+    }
+
+    return ( ".." == pathString ) ? pathString : ".";
+}
+
+/*!
+ * \brief Strip directory and suffix from the path.
+ *
+ * \param suffix    The suffix to remove if it ends the name.
+ *
+ * \return The name without it's access path and the \p suffix if it's provide.
+ *
+ * \sa Path::baseName( std::string, const std::string & )
+ */
+std::string_view PathView::baseName( std::string_view suffix ) const noexcept
+{
+    std::string_view pathString = stripLastSeparator();
+    const std::string_view::size_type lastSeparatorPosition = findLastSeparator( pathString );
+
+    // Keeps the whole path if there is no access path or it's the unix root directory '/'
+    if ( std::string_view::npos != lastSeparatorPosition && 1 < pathString.size() )
+    {
+        pathString.remove_prefix( lastSeparatorPosition + 1 );
+    }
+
+    if ( ! suffix.empty() && suffix.size() <= pathString.size() &&
+         suffix == pathString.substr( pathString.size() - suffix.size() ) )
+    {
+        pathString.remove_suffix( suffix.size() );
+    }
+
+    return pathString;
+}
+
+/*!
+ * \brief Get the extension of the name.
+ *
+ * \return The end of the name after its last \e . , empty if there is none.
+ *
+ * \sa FilePath::extractExtension( const std::string &, const char )
+ */
+std::string_view PathView::extension() const noexcept
+{
+    const std::string_view name = baseName();
+    const std::string_view::size_type separatorPosition = name.find_last_of( '.' );
+
+    return ( std::string_view::npos != separatorPosition ) ? name.substr( separatorPosition + 1 ) : std::string_view();
+}
+
+
+//
+// Private static functions
+//
+
+/*!
+ * \brief Find the last directory separator.
+ *
+ * \param pathString  The path in which the separator will be look for.
+ *
+ * \return The position of the last separator, \c std::string_view::npos if there is none.
+ */
+std::string_view::size_type PathView::findLastSeparator( std::string_view pathString ) noexcept
+{
+    return separators::findLast( pathString, Path::standardSeparator(), Path::systemSeparator() );
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Removes the last separator if it ends the path.
+ *
+ * \return The parsed path without the last separator if it was at the end of the path.
+ *
+ * \sa Path::stripLastSeparator( std::string & )
+ */
+std::string_view PathView::stripLastSeparator() const noexcept
+{
+    std::string_view pathString = myPath;
+
+    if ( 1 < pathString.size() && isSeparator( pathString.back() ) )
+    {
+        pathString.remove_suffix( 1 );
+    }
+
+    return pathString;
+}
+
+
+//
+// ComponentIterator
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Default constructor : create an iterator equal to the end of an empty path.
+ */
+PathView::ComponentIterator::ComponentIterator() noexcept
+    : myPath(),
+    myOffset( 0 ),
+    myComponent()
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * \param pathString  The path to iterate over.
+ * \param offset      The position from which to look for the component.
+ */
+PathView::ComponentIterator::ComponentIterator( std::string_view pathString, std::string_view::size_type offset ) noexcept
+    : myPath( pathString ),
+    myOffset( offset ),
+    myComponent()
+{
+    // The root directory is the only component containing a separator
+    if ( 0 == offset && ! pathString.empty() && isSeparator( pathString.front() ) )
+    {
+        myComponent = pathString.substr( 0, 1 );
+    }
+    else
+    {
+        readComponent( offset );
+    }
+}
+
+/*!
+ * \brief Move to the next component.
+ *
+ * \return A reference on the current object.
+ */
+PathView::ComponentIterator & PathView::ComponentIterator::operator ++() noexcept
+{
+    readComponent( myOffset + myComponent.size() );
+
+    return *this;
+}
+
+/*!
+ * \brief Move to the next component.
+ *
+ * \return A copy of the iterator before it moved.
+ */
+PathView::ComponentIterator PathView::ComponentIterator::operator ++( int ) noexcept
+{
+    ComponentIterator iterator( *this );
+
+    ++*this;
+
+    return iterator;
+}
+
+/*!
+ * \brief Read the first component starting from \p offset.
+ *
+ * \param offset  The position from which to skip the separators.
+ */
+void PathView::ComponentIterator::readComponent( std::string_view::size_type offset ) noexcept
+{
+    while ( offset < myPath.size() && isSeparator( myPath[ offset ] ) )
+    {
+        ++offset;
+    }
+
+    const std::string_view::size_type end = std::min( separators::findFirst( myPath, Path::standardSeparator(), Path::systemSeparator(), offset ),
+                                                      myPath.size() );
+
+    myOffset = offset;
+    myComponent = myPath.substr( offset, end - offset );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
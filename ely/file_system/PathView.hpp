@@ -0,0 +1,268 @@
+/*!
+ * \file PathView.hpp
+ *
+ * \author Ely
+ *
+ * \brief A class for parse a path without copying it.
+ */
+#ifndef PATH_VIEW_HPP
+#define PATH_VIEW_HPP
+
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/Path.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The PathView class
+ *
+ * Parses a path in place : every result is a view on the parsed string, or on a
+ * string literal, so nothing is allocated.\n
+ * The view must not outlive the string it refers to.\n\n
+ *
+ * The results have the same semantics as \c Path::dirName() , \c Path::baseName() and
+ * \c FilePath::extractExtension() except that the system separators are not converted.\n\n
+ *
+ * Iterating over a view gives the components of the path :
+ * \e /home/ely/ gives \e / , \e home and \e ely .
+ */
+class PathView
+{
+public:
+    class ComponentIterator;
+
+
+    constexpr PathView() noexcept;
+    constexpr PathView( std::string_view pathString ) noexcept;
+    constexpr PathView( const char * pathString ) noexcept;
+    PathView( const std::string & pathString ) noexcept;
+    PathView( const Path & path ) noexcept;
+
+
+    constexpr std::string_view toString() const noexcept;
+
+    std::string_view dirName() const noexcept;
+    std::string_view baseName( std::string_view suffix = std::string_view() ) const noexcept;
+    std::string_view extension() const noexcept;
+
+    ComponentIterator begin() const noexcept;
+    ComponentIterator end() const noexcept;
+
+private:
+    static constexpr bool isSeparator( char character ) noexcept;
+    static std::string_view::size_type findLastSeparator( std::string_view pathString ) noexcept;
+
+
+    std::string_view stripLastSeparator() const noexcept;
+
+
+    std::string_view myPath;
+};
+
+
+/*!
+ * \brief The PathView::ComponentIterator class
+ *
+ * A forward iterator over the components of a path.\n
+ * The root directory is a component, the empty components are skipped.
+ */
+class PathView::ComponentIterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::string_view value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::string_view * pointer;
+    typedef const std::string_view & reference;
+
+
+    ComponentIterator() noexcept;
+    ComponentIterator( std::string_view pathString, std::string_view::size_type offset ) noexcept;
+
+
+    reference operator *() const noexcept;
+    pointer operator ->() const noexcept;
+
+    ComponentIterator & operator ++() noexcept;
+    ComponentIterator operator ++( int ) noexcept;
+
+    bool operator ==( const ComponentIterator & iterator ) const noexcept;
+    bool operator !=( const ComponentIterator & iterator ) const noexcept;
+
+private:
+    void readComponent( std::string_view::size_type offset ) noexcept;
+
+
+    std::string_view myPath;
+    std::string_view::size_type myOffset;
+    std::string_view myComponent;
+};
+
+
+//
+// Constructors
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Default constructor : create a view on an empty path.
+ */
+constexpr PathView::PathView() noexcept
+    : myPath()
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * \param pathString  The path to parse.
+ */
+constexpr PathView::PathView( std::string_view pathString ) noexcept
+    : myPath( pathString )
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * \param pathString  The null terminated path to parse.
+ */
+constexpr PathView::PathView( const char * pathString ) noexcept
+    : myPath( pathString )
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * \param pathString  The path to parse, the view is valid until \p pathString is modified.
+ */
+inline PathView::PathView( const std::string & pathString ) noexcept
+    : myPath( pathString )
+{}
+
+/*!
+ * \brief Constructor
+ *
+ * \param path  The path to parse, the view is valid until \p path is modified.
+ */
+inline PathView::PathView( const Path & path ) noexcept
+    : myPath( path.toString() )
+{}
+
+
+//
+// Public inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The parsed path.
+ */
+constexpr std::string_view PathView::toString() const noexcept
+{
+    return myPath;
+}
+
+/*!
+ * \brief Get an iterator on the first component of the path.
+ *
+ * \return An iterator on the first component, equal to \c end() if the path is empty.
+ */
+inline PathView::ComponentIterator PathView::begin() const noexcept
+{
+    return ComponentIterator( myPath, 0 );
+}
+
+/*!
+ * \brief Get an iterator after the last component of the path.
+ *
+ * \return The end iterator.
+ */
+inline PathView::ComponentIterator PathView::end() const noexcept
+{
+    return ComponentIterator( myPath, myPath.size() );
+}
+
+
+//
+// Private static inline functions
+//
+
+/*!
+ * \brief Check if a character is a directory separator.
+ *
+ * \param character   The character to check.
+ *
+ * \return \c true if \p character is the standard or the system separator, \c false otherwise.
+ */
+constexpr bool PathView::isSeparator( char character ) noexcept
+{
+    return Path::standardSeparator() == character || Path::systemSeparator() == character;
+}
+
+
+//
+// ComponentIterator inline functions
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The current component.
+ */
+inline PathView::ComponentIterator::reference PathView::ComponentIterator::operator *() const noexcept
+{
+    return myComponent;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return A pointer on the current component.
+ */
+inline PathView::ComponentIterator::pointer PathView::ComponentIterator::operator ->() const noexcept
+{
+    return &myComponent;
+}
+
+/*!
+ * \brief Operator <em>equal to</em>
+ *
+ * \param iterator    An iterator on the same path.
+ *
+ * \return \c true if both iterators point to the same component, \c false otherwise.
+ */
+inline bool PathView::ComponentIterator::operator ==( const ComponentIterator & iterator ) const noexcept
+{
+    return myOffset == iterator.myOffset;
+}
+
+/*!
+ * \brief Operator <em>not equal to</em>
+ *
+ * \param iterator    An iterator on the same path.
+ *
+ * \return \c true if the iterators point to different components, \c false otherwise.
+ */
+inline bool PathView::ComponentIterator::operator !=( const ComponentIterator & iterator ) const noexcept
+{
+    return ! ( *this == iterator );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+#endif // PATH_VIEW_HPP
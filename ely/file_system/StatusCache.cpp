@@ -0,0 +1,533 @@
+#include "ely/file_system/StatusCache.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <algorithm>
+#include <cerrno>
+#include <functional>
+#include <iterator>
+
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/// The events changing the metadata of the files of a directory, or the directory itself.
+constexpr std::uint32_t watchedEvents = IN_ATTRIB | IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                        IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+/// The events after which a directory is not watched anymore.
+constexpr std::uint32_t lostEvents = IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT | IN_IGNORED;
+
+/// The memory used by an entry besides its path : the nodes of the list, of the index and of the watch.
+constexpr std::size_t entryOverhead = 8 * sizeof( void * );
+
+
+} // namespace
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * \param memoryBudget    The maximum size of the memory used by the entries.
+ */
+StatusCache::StatusCache( std::size_t memoryBudget )
+    : myDescriptor( ::inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) ),
+    myMemoryBudget( memoryBudget ),
+    myMutex(),
+    myEntries(),
+    myIndex(),
+    myWatches(),
+    myMemoryUsage( 0 ),
+    myNumberOfHits( 0 ),
+    myNumberOfMisses( 0 )
+{}
+
+/*!
+ * \brief Destructor
+ *
+ * Closing the \e inotify instance removes every watch.
+ */
+StatusCache::~StatusCache()
+{
+    if ( isWatching() )
+    {
+        ::close( myDescriptor );
+    }
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Get the metadata of a file.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ *
+ * \sa getStatus( const Path &, FileStatus &, std::error_code & )
+ */
+bool StatusCache::getStatus( const Path & path, FileStatus & status )
+{
+    std::error_code error;
+
+    return getStatus( path, status, error );
+}
+
+/*!
+ * \brief Get the metadata of a file.
+ *
+ * The metadata is read from the cache if the file didn't change since it was read,
+ * else it is read with \e stat and cached.\n
+ * The directories are watched before the file is read, so a change during the reading
+ * is never missed : the result is not cached.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ * \param error   Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the metadata was read, \c false otherwise.
+ */
+bool StatusCache::getStatus( const Path & path, FileStatus & status, std::error_code & error )
+{
+    const std::string_view key = path.toString();
+    std::unique_lock< std::mutex > lock( myMutex );
+
+    readEvents();
+
+    const auto found = myIndex.find( key );
+
+    if ( myIndex.end() != found )
+    {
+        myEntries.splice( myEntries.begin(), myEntries, found->second );
+        ++myNumberOfHits;
+        status = found->second->status;
+        error = found->second->error;
+
+        return ! error;
+    }
+
+    ++myNumberOfMisses;
+
+    const int parentWatch = isWatching() ? addWatch( std::string( path.getAccessPath() ) ) : -1;
+
+    if ( -1 == parentWatch )
+    {
+        lock.unlock();
+
+        return file_system::getStatus( path, status, error );
+    }
+
+    const std::uint64_t parentGeneration = myWatches[ parentWatch ].generation;
+
+    lock.unlock();
+
+    bool isCacheable = readStatus( path, status, error );
+    int selfWatch = -1;
+    std::uint64_t selfGeneration = 0;
+
+    // A directory changes with its files, it is read again once watched
+    if ( isCacheable && ! error && Directory::EntryType::Directory == status.type )
+    {
+        lock.lock();
+        selfWatch = addWatch( std::string( key ) );
+        selfGeneration = ( -1 != selfWatch ) ? myWatches[ selfWatch ].generation : 0;
+        lock.unlock();
+
+        isCacheable = ( -1 != selfWatch ) && readStatus( path, status, error ) && ! error &&
+                      ( Directory::EntryType::Directory == status.type );
+    }
+
+    lock.lock();
+    readEvents();
+
+    if ( isCacheable && isCurrent( parentWatch, parentGeneration ) &&
+         ( -1 == selfWatch || isCurrent( selfWatch, selfGeneration ) ) && myIndex.end() == myIndex.find( key ) )
+    {
+        insert( key, key.size() - path.getName().size(), status, error, parentWatch, selfWatch );
+    }
+    else
+    {
+        releaseWatch( parentWatch );
+
+        if ( -1 != selfWatch )
+        {
+            releaseWatch( selfWatch );
+        }
+    }
+
+    return ! error;
+}
+
+/*!
+ * \brief Remove the metadata of a file from the cache.
+ *
+ * \param path    The path of the file.
+ */
+void StatusCache::invalidate( const Path & path )
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+    const auto found = myIndex.find( path.toString() );
+
+    if ( myIndex.end() != found )
+    {
+        erase( found->second );
+    }
+}
+
+/*!
+ * \brief Remove every entry from the cache.
+ */
+void StatusCache::clear()
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    while ( ! myEntries.empty() )
+    {
+        erase( myEntries.begin() );
+    }
+}
+
+
+//
+// Accessors
+//
+
+/*!
+ * \brief Accessor
+ *
+ * \return The memory used by the entries.
+ */
+std::size_t StatusCache::getMemoryUsage() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myMemoryUsage;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of entries.
+ */
+std::size_t StatusCache::getSize() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myEntries.size();
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of queries answered from the cache.
+ */
+std::uint64_t StatusCache::getNumberOfHits() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myNumberOfHits;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of queries which had to read the file.
+ */
+std::uint64_t StatusCache::getNumberOfMisses() const
+{
+    std::lock_guard< std::mutex > lock( myMutex );
+
+    return myNumberOfMisses;
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief Read the metadata of a file and tell if it can be cached.
+ *
+ * A symbolic link is followed but not cached since its target isn't watched.
+ * Only the failures of a missing file are cached.
+ *
+ * \param path    The path of the file.
+ * \param status  Receives the metadata.
+ * \param error   Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the result can be cached, \c false otherwise.
+ */
+bool StatusCache::readStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept
+{
+    if ( ! getLinkStatus( path, status, error ) )
+    {
+        status = FileStatus();
+
+        return std::errc::no_such_file_or_directory == error;
+    }
+
+    if ( Directory::EntryType::SymbolicLink == status.type )
+    {
+        file_system::getStatus( path, status, error );
+
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Watch a directory.
+ *
+ * The mutex must be locked.
+ *
+ * \param directory   The path of the directory.
+ *
+ * \return The watch descriptor, referenced once more, \c -1 on failure.
+ */
+int StatusCache::addWatch( const std::string & directory )
+{
+    const int watch = ::inotify_add_watch( myDescriptor, directory.c_str(), watchedEvents );
+
+    if ( -1 != watch )
+    {
+        // The same directory under another path has the same watch
+        ++myWatches[ watch ].references;
+    }
+
+    return watch;
+}
+
+/*!
+ * \brief Release a reference on a watch, the directory isn't watched anymore without reference.
+ *
+ * The mutex must be locked.
+ *
+ * \param watch   The watch descriptor.
+ */
+void StatusCache::releaseWatch( int watch )
+{
+    const auto found = myWatches.find( watch );
+
+    if ( myWatches.end() != found && 0 == --found->second.references )
+    {
+        ::inotify_rm_watch( myDescriptor, watch );
+        myWatches.erase( found );
+    }
+}
+
+/*!
+ * \brief Check if a directory didn't change.
+ *
+ * The mutex must be locked.
+ *
+ * \param watch       The watch descriptor.
+ * \param generation  The generation of the watch before the reading.
+ *
+ * \return \c true if no event happened on the directory since the reading, \c false otherwise.
+ */
+bool StatusCache::isCurrent( int watch, std::uint64_t generation ) const
+{
+    const auto found = myWatches.find( watch );
+
+    return myWatches.end() != found && generation == found->second.generation;
+}
+
+/*!
+ * \brief Add an entry, the least recently used entries are removed to respect the budget.
+ *
+ * The mutex must be locked, the entry takes the references on the watches.
+ *
+ * \param path            The path of the file.
+ * \param nameOffset      The offset of the name of the file in its path.
+ * \param status          The metadata of the file.
+ * \param error           The failure of the reading.
+ * \param parentWatch     The watch of the parent directory.
+ * \param selfWatch       The watch of the file if it is a directory, \c -1 otherwise.
+ */
+void StatusCache::insert( std::string_view path, std::size_t nameOffset, const FileStatus & status,
+                          const std::error_code & error, int parentWatch, int selfWatch )
+{
+    myEntries.push_front( { std::string( path ), nameOffset, status, error, parentWatch, selfWatch, 0 } );
+
+    Entry & entry = myEntries.front();
+
+    entry.memory = sizeof( Entry ) + entry.path.capacity() + entryOverhead;
+    myMemoryUsage += entry.memory;
+    myIndex.emplace( entry.path, myEntries.begin() );
+    myWatches[ parentWatch ].children.emplace( std::string_view( entry.path ).substr( nameOffset ), myEntries.begin() );
+
+    if ( -1 != selfWatch )
+    {
+        myWatches[ selfWatch ].selves.push_back( myEntries.begin() );
+    }
+
+    while ( myMemoryBudget < myMemoryUsage && ! myEntries.empty() )
+    {
+        erase( std::prev( myEntries.end() ) );
+    }
+}
+
+/*!
+ * \brief Remove an entry and release its watches.
+ *
+ * The mutex must be locked.
+ *
+ * \param entry   The entry to remove.
+ */
+void StatusCache::erase( Entries::iterator entry )
+{
+    const auto parent = myWatches.find( entry->parentWatch );
+
+    if ( myWatches.end() != parent )
+    {
+        auto range = parent->second.children.equal_range( std::string_view( entry->path ).substr( entry->nameOffset ) );
+
+        for ( ; range.first != range.second; ++range.first )
+        {
+            if ( range.first->second == entry )
+            {
+                parent->second.children.erase( range.first );
+                break;
+            }
+        }
+    }
+
+    const auto self = myWatches.find( entry->selfWatch );
+
+    if ( myWatches.end() != self )
+    {
+        std::vector< Entries::iterator > & selves = self->second.selves;
+
+        selves.erase( std::remove( selves.begin(), selves.end(), entry ), selves.end() );
+    }
+
+    releaseWatch( entry->parentWatch );
+
+    if ( -1 != entry->selfWatch )
+    {
+        releaseWatch( entry->selfWatch );
+    }
+
+    myMemoryUsage -= entry->memory;
+    myIndex.erase( entry->path );
+    myEntries.erase( entry );
+}
+
+/*!
+ * \brief Read the pending events and remove the entries of the files changed.
+ *
+ * The mutex must be locked.
+ */
+void StatusCache::readEvents()
+{
+    if ( ! isWatching() )
+    {
+        return;
+    }
+
+    alignas( ::inotify_event ) char buffer[ 16 * 1024 ];
+    ::ssize_t size;
+
+    while ( 0 < ( size = ::read( myDescriptor, buffer, sizeof( buffer ) ) ) )
+    {
+        for ( const char * event = buffer; event < buffer + size; )
+        {
+            const ::inotify_event & header = *reinterpret_cast< const ::inotify_event * >( event );
+
+            event += sizeof( ::inotify_event ) + header.len;
+
+            // Events were lost, on any watch : the readings pending are not cached either
+            if ( 0 != ( header.mask & IN_Q_OVERFLOW ) )
+            {
+                for ( auto & watch : myWatches )
+                {
+                    ++watch.second.generation;
+                }
+
+                while ( ! myEntries.empty() )
+                {
+                    erase( myEntries.begin() );
+                }
+
+                continue;
+            }
+
+            const auto found = myWatches.find( header.wd );
+
+            if ( myWatches.end() == found )
+            {
+                continue;
+            }
+
+            Watch & watch = found->second;
+            const bool isLost = ( 0 != ( header.mask & lostEvents ) );
+            std::vector< Entries::iterator > changed( watch.selves );
+
+            ++watch.generation;
+
+            if ( isLost )
+            {
+                for ( const auto & child : watch.children )
+                {
+                    changed.push_back( child.second );
+                }
+            }
+            else if ( 0 != header.len )
+            {
+                const auto range = watch.children.equal_range( std::string_view( header.name ) );
+
+                std::transform( range.first, range.second, std::back_inserter( changed ), []( const auto & child )
+                {
+                    return child.second;
+                } );
+            }
+
+            // A directory can be its own parent through another path
+            std::sort( changed.begin(), changed.end(), []( Entries::iterator first, Entries::iterator second )
+            {
+                return std::less< const Entry * >()( &*first, &*second );
+            } );
+            changed.erase( std::unique( changed.begin(), changed.end() ), changed.end() );
+
+            // The watch can be released by the removal of the entries
+            const int watchDescriptor = header.wd;
+
+            for ( Entries::iterator entry : changed )
+            {
+                erase( entry );
+            }
+
+            if ( 0 != ( header.mask & IN_IGNORED ) )
+            {
+                myWatches.erase( watchDescriptor );
+            }
+        }
+    }
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
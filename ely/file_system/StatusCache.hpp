@@ -0,0 +1,180 @@
+/*!
+ * \file StatusCache.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the StatusCache class.
+ */
+#ifndef STATUS_CACHE_HPP
+#define STATUS_CACHE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/FileStatus.hpp"
+#include "ely/file_system/Path.hpp"
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief The StatusCache class
+ *
+ * Keeps the metadata of the files read, until they change.\n\n
+ *
+ * The directory of each file cached is watched with \e inotify , as well as each directory
+ * cached : an entry is removed as soon as its file is modified, created, removed or renamed.
+ * The pending events are read by each query, so a change done before a query is always seen.\n
+ * The missing files are cached too. The symbolic links are not, their target is read each time.\n
+ * The least recently used entries are removed to keep the memory used by the entries under a
+ * budget, a directory is not watched anymore once it has no entry.\n\n
+ *
+ * The changes of the parents of the directories watched, the changes made through memory
+ * mappings and the changes of the other hard links of a file are not seen.\n
+ * The files are read without caching when \e inotify is unavailable or out of watches.\n
+ * The cache can be shared by many threads.
+ */
+class StatusCache final
+{
+public:
+    static constexpr std::size_t defaultMemoryBudget() noexcept;
+
+
+    explicit StatusCache( std::size_t memoryBudget = defaultMemoryBudget() );
+    ~StatusCache();
+
+    StatusCache( const StatusCache & ) = delete;
+    StatusCache & operator =( const StatusCache & ) = delete;
+
+
+    bool getStatus( const Path & path, FileStatus & status );
+    bool getStatus( const Path & path, FileStatus & status, std::error_code & error );
+
+    void invalidate( const Path & path );
+    void clear();
+
+
+    bool isWatching() const noexcept;
+    std::size_t getMemoryBudget() const noexcept;
+    std::size_t getMemoryUsage() const;
+    std::size_t getSize() const;
+    std::uint64_t getNumberOfHits() const;
+    std::uint64_t getNumberOfMisses() const;
+
+private:
+    /// The metadata of a file.
+    struct Entry
+    {
+        std::string path;
+        /// The offset of the name of the file in its path.
+        std::size_t nameOffset;
+        FileStatus status;
+        /// The failure of the reading, only for a missing file.
+        std::error_code error;
+        /// The watch of the parent directory.
+        int parentWatch;
+        /// The watch of the file if it is a directory, \c -1 otherwise.
+        int selfWatch;
+        /// The memory used by the entry.
+        std::size_t memory;
+    };
+
+    /// The entries, from the most to the least recently used.
+    typedef std::list< Entry > Entries;
+
+    /// A directory watched.
+    struct Watch
+    {
+        /// The number of entries and of pending readings using the watch.
+        std::size_t references;
+        /// Incremented by each event and when events are lost, a reading started before isn't cached.
+        std::uint64_t generation;
+        /// The entries of the files of the directory, by name.
+        std::unordered_multimap< std::string_view, Entries::iterator > children;
+        /// The entries of the directory itself.
+        std::vector< Entries::iterator > selves;
+    };
+
+
+    static bool readStatus( const Path & path, FileStatus & status, std::error_code & error ) noexcept;
+
+    int addWatch( const std::string & directory );
+    void releaseWatch( int watch );
+    bool isCurrent( int watch, std::uint64_t generation ) const;
+
+    void insert( std::string_view path, std::size_t nameOffset, const FileStatus & status,
+                 const std::error_code & error, int parentWatch, int selfWatch );
+    void erase( Entries::iterator entry );
+    void readEvents();
+
+
+    const int myDescriptor;
+    const std::size_t myMemoryBudget;
+
+    mutable std::mutex myMutex;
+    Entries myEntries;
+    /// The entries by path, the keys are the paths stored in the entries.
+    std::unordered_map< std::string_view, Entries::iterator > myIndex;
+    std::unordered_map< int, Watch > myWatches;
+    std::size_t myMemoryUsage;
+    std::uint64_t myNumberOfHits;
+    std::uint64_t myNumberOfMisses;
+};
+
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The default size of the memory used by the entries.
+ */
+constexpr std::size_t StatusCache::defaultMemoryBudget() noexcept
+{
+    return 64 * 1024 * 1024;
+}
+
+/*!
+ * \brief Check if the changes are watched.
+ *
+ * \return \c true if the files are cached, \c false if \e inotify is unavailable.
+ */
+inline bool StatusCache::isWatching() const noexcept
+{
+    return -1 != myDescriptor;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The maximum size of the memory used by the entries.
+ */
+inline std::size_t StatusCache::getMemoryBudget() const noexcept
+{
+    return myMemoryBudget;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_USING_LINUX_API
+
+
+#endif // STATUS_CACHE_HPP
@@ -0,0 +1,149 @@
+#include "ely/file_system/normalization.hpp"
+
+
+#include <cstring>
+
+
+#include "ely/file_system/Path.hpp"
+#include "ely/file_system/PathView.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+/*!
+ * \brief Normalize a path in a single pass.
+ *
+ * The result is never longer than \p pathString so it's written over it.\n
+ * The separators are converted to the standard one, a path normalized to nothing
+ * becomes \e . and the empty path stays empty.
+ *
+ * \param pathString  The path to normalize.
+ * \param size        The size of \p pathString .
+ *
+ * \return The size of the normalized path.
+ */
+std::size_t normalizeInPlace( char * pathString, std::size_t size ) noexcept
+{
+    const auto isSeparator = [] ( char character ) noexcept
+    {
+        return Path::standardSeparator() == character || Path::systemSeparator() == character;
+    };
+
+    const bool isAbsolute = 0 < size && isSeparator( pathString[ 0 ] );
+    std::size_t written = 0;
+
+    if ( isAbsolute )
+    {
+        pathString[ written++ ] = Path::standardSeparator();
+    }
+
+    // The components before this position can't be collapsed : the root or leading '..'
+    std::size_t floor = written;
+    std::size_t read = 0;
+
+    while ( read < size )
+    {
+        while ( read < size && isSeparator( pathString[ read ] ) )
+        {
+            ++read;
+        }
+
+        const std::size_t start = read;
+
+        while ( read < size && ! isSeparator( pathString[ read ] ) )
+        {
+            ++read;
+        }
+
+        const std::string_view component( pathString + start, read - start );
+
+        if ( component.empty() || Path::currentDirectory() == component )
+        {
+            continue;
+        }
+
+        if ( Path::parentDirectory() == component )
+        {
+            if ( floor < written )
+            {
+                // Removes the last component and its separator
+                while ( floor < written && Path::standardSeparator() != pathString[ written - 1 ] )
+                {
+                    --written;
+                }
+
+                if ( floor < written )
+                {
+                    --written;
+                }
+
+                continue;
+            }
+
+            if ( isAbsolute )
+            {
+                // The parent of the root directory is the root directory
+                continue;
+            }
+        }
+
+        if ( 0 < written && Path::standardSeparator() != pathString[ written - 1 ] )
+        {
+            pathString[ written++ ] = Path::standardSeparator();
+        }
+
+        // The component is never before the position where it's written
+        std::memmove( pathString + written, component.data(), component.size() );
+        written += component.size();
+
+        if ( Path::parentDirectory() == component )
+        {
+            floor = written;
+        }
+    }
+
+    if ( 0 == written && 0 < size )
+    {
+        pathString[ written++ ] = '.';
+    }
+
+    return written;
+}
+
+
+//
+// NormalizedPathView
+//
+
+/*!
+ * \brief Constructor
+ *
+ * \param pathString  The path to normalize.
+ */
+NormalizedPathView::NormalizedPathView( std::string_view pathString )
+    : myBuffer(),
+    myPath()
+{
+    char * buffer = myInlineBuffer;
+
+    if ( inlineCapacity() < pathString.size() )
+    {
+        myBuffer.reset( new char[ pathString.size() ] );
+        buffer = myBuffer.get();
+    }
+
+    if ( ! pathString.empty() )
+    {
+        std::memcpy( buffer, pathString.data(), pathString.size() );
+    }
+
+    myPath = std::string_view( buffer, normalizeInPlace( buffer, pathString.size() ) );
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
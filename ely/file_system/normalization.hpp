@@ -0,0 +1,92 @@
+/*!
+ * \file normalization.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file for the lexical normalization of the paths.
+ *
+ * A normalized path has no \e . components, no duplicate or trailing separators,
+ * and its \e .. components are collapsed with the components they follow :
+ * \e ./home//ely/../ely/./script.sh becomes \e home/ely/script.sh .\n
+ * The file system is not accessed, so the symbolic links are not resolved.
+ */
+#ifndef NORMALIZATION_HPP
+#define NORMALIZATION_HPP
+
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+std::size_t normalizeInPlace( char * pathString, std::size_t size ) noexcept;
+
+
+/*!
+ * \brief The NormalizedPathView class
+ *
+ * Normalizes a path in its own buffer and gives a view on the result.\n
+ * The buffer is a member of the object for the paths shorter than \c inlineCapacity() ,
+ * only the longer ones are allocated.
+ *
+ * \sa normalizeInPlace()
+ */
+class NormalizedPathView final
+{
+public:
+    static constexpr std::size_t inlineCapacity() noexcept;
+
+
+    explicit NormalizedPathView( std::string_view pathString );
+
+    NormalizedPathView( const NormalizedPathView & ) = delete;
+    NormalizedPathView & operator =( const NormalizedPathView & ) = delete;
+
+
+    std::string_view toString() const noexcept;
+
+private:
+    char myInlineBuffer[ 256 ];
+    std::unique_ptr< char[] > myBuffer;
+    std::string_view myPath;
+};
+
+
+//
+// Inline functions
+//
+
+/*!
+ * \brief Constant accessor
+ *
+ * \return The size of the longest path normalized without allocation.
+ */
+constexpr std::size_t NormalizedPathView::inlineCapacity() noexcept
+{
+    return sizeof( myInlineBuffer );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The normalized path, valid as long as the object.
+ */
+inline std::string_view NormalizedPathView::toString() const noexcept
+{
+    return myPath;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+#endif // NORMALIZATION_HPP
@@ -0,0 +1,410 @@
+#include "ely/file_system/operations.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined ( ELY_USING_LINUX_API )
+#   include <sys/sendfile.h>
+#endif
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace
+{
+
+
+/// The size of the buffer of the read and write loop.
+constexpr std::size_t copyBufferSize = 1024 * 1024;
+/// The maximum size copied by a system call, below the limit of \e sendfile .
+constexpr std::size_t copyChunkSize = 1024 * 1024 * 1024;
+
+
+/// Closes a file descriptor when leaving the scope.
+class DescriptorGuard
+{
+public:
+    explicit DescriptorGuard( int descriptor ) noexcept
+        : myDescriptor( descriptor )
+    {}
+
+    ~DescriptorGuard()
+    {
+        if ( 0 <= myDescriptor )
+        {
+            ::close( myDescriptor );
+        }
+    }
+
+    DescriptorGuard( const DescriptorGuard & ) = delete;
+    DescriptorGuard & operator =( const DescriptorGuard & ) = delete;
+
+    int get() const noexcept
+    {
+        return myDescriptor;
+    }
+
+private:
+    int myDescriptor;
+};
+
+
+/*!
+ * \brief Check if an error of \e copy_file_range or \e sendfile means the copy has to be done another way.
+ *
+ * \param error   The \e errno value.
+ *
+ * \return \c true if the system call isn't supported for these files.
+ */
+bool isUnsupported( int error ) noexcept
+{
+    return ENOSYS == error || EXDEV == error || EINVAL == error || EOPNOTSUPP == error || EPERM == error;
+}
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+/*!
+ * \brief Copy with \e copy_file_range , in the kernel and possibly without copying the blocks.
+ *
+ * \return \c 0 on success, \c -1 if unsupported for these files, the \e errno value otherwise.
+ */
+int copyWithCopyFileRange( int input, int output ) noexcept
+{
+    bool isFirstCall = true;
+
+    for ( ; ; )
+    {
+        const ssize_t copied = ::copy_file_range( input, nullptr, output, nullptr, copyChunkSize, 0 );
+
+        if ( 0 < copied )
+        {
+            isFirstCall = false;
+        }
+        else if ( 0 == copied )
+        {
+            // Some pseudo file systems report an empty file, let the other ways read it
+            return isFirstCall ? -1 : 0;
+        }
+        else if ( EINTR != errno )
+        {
+            return ( isFirstCall && isUnsupported( errno ) ) ? -1 : errno;
+        }
+    }
+}
+
+/*!
+ * \brief Copy with \e sendfile , in the kernel.
+ *
+ * \return \c 0 on success, \c -1 if unsupported for these files, the \e errno value otherwise.
+ */
+int copyWithSendfile( int input, int output ) noexcept
+{
+    bool isFirstCall = true;
+
+    for ( ; ; )
+    {
+        const ssize_t copied = ::sendfile( output, input, nullptr, copyChunkSize );
+
+        if ( 0 < copied )
+        {
+            isFirstCall = false;
+        }
+        else if ( 0 == copied )
+        {
+            return 0;
+        }
+        else if ( EINTR != errno )
+        {
+            return ( isFirstCall && isUnsupported( errno ) ) ? -1 : errno;
+        }
+    }
+}
+
+#endif // ELY_USING_LINUX_API
+
+/*!
+ * \brief Copy with a loop of large reads and writes.
+ *
+ * \return \c 0 on success, the \e errno value otherwise.
+ */
+int copyWithReadWrite( int input, int output ) noexcept
+{
+    std::unique_ptr< char[] > buffer( new ( std::nothrow ) char[ copyBufferSize ] );
+
+    if ( ! buffer )
+    {
+        return ENOMEM;
+    }
+
+    for ( ; ; )
+    {
+        const ssize_t read = ::read( input, buffer.get(), copyBufferSize );
+
+        if ( 0 == read )
+        {
+            return 0;
+        }
+        else if ( 0 > read )
+        {
+            if ( EINTR != errno )
+            {
+                return errno;
+            }
+
+            continue;
+        }
+
+        for ( ssize_t written = 0; written < read; )
+        {
+            const ssize_t size = ::write( output, buffer.get() + written, static_cast< std::size_t >( read - written ) );
+
+            if ( 0 < size )
+            {
+                written += size;
+            }
+            else if ( 0 == size )
+            {
+                return EIO;
+            }
+            else if ( EINTR != errno )
+            {
+                return errno;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Copy the content of a file in another one.
+ *
+ * \return \c 0 on success, the \e errno value otherwise.
+ */
+int copyContent( int input, int output ) noexcept
+{
+#if defined ( ELY_USING_LINUX_API )
+
+    int result = copyWithCopyFileRange( input, output );
+
+    if ( -1 != result )
+    {
+        return result;
+    }
+
+    // Nothing has been copied, the offsets are unchanged
+    result = copyWithSendfile( input, output );
+
+    if ( -1 != result )
+    {
+        return result;
+    }
+
+#endif // ELY_USING_LINUX_API
+
+    return copyWithReadWrite( input, output );
+}
+
+
+} // namespace
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Copy a file.
+ *
+ * \param source          The file to copy.
+ * \param destination     The copy, replaced if it exists.
+ *
+ * \return \c true if the file was successfully copied, \c false otherwise.
+ *
+ * \sa copyFile( const FilePath &, const FilePath &, std::error_code & )
+ */
+bool copyFile( const FilePath & source, const FilePath & destination )
+{
+    std::error_code error;
+
+    return copyFile( source, destination, error );
+}
+
+/*!
+ * \brief Copy a file.
+ *
+ * The copy has the permissions of \p source . It is removed if the copy fails.
+ *
+ * \param source          The file to copy.
+ * \param destination     The copy, replaced if it exists.
+ * \param error           Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the file was successfully copied, \c false otherwise.
+ */
+bool copyFile( const FilePath & source, const FilePath & destination, std::error_code & error ) noexcept
+{
+    error.clear();
+
+    try
+    {
+        const std::string sourceString( source.toString() );
+        const std::string destinationString( destination.toString() );
+        const DescriptorGuard input( ::open( sourceString.c_str(), O_RDONLY | O_CLOEXEC ) );
+        struct stat status;
+
+        if ( 0 > input.get() || 0 != ::fstat( input.get(), &status ) )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+
+        if ( S_ISDIR( status.st_mode ) )
+        {
+            error.assign( EISDIR, std::system_category() );
+
+            return false;
+        }
+
+        const mode_t mode = status.st_mode & ( S_IRWXU | S_IRWXG | S_IRWXO );
+        const DescriptorGuard output( ::open( destinationString.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, mode ) );
+        struct stat destinationStatus;
+
+        if ( 0 > output.get() || 0 != ::fstat( output.get(), &destinationStatus ) )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+
+        // Truncating the destination would erase the source
+        if ( status.st_dev == destinationStatus.st_dev && status.st_ino == destinationStatus.st_ino )
+        {
+            error.assign( EINVAL, std::system_category() );
+
+            return false;
+        }
+
+        if ( 0 != ::ftruncate( output.get(), 0 ) )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+
+        int result = copyContent( input.get(), output.get() );
+
+        // The mode given to open is filtered by the umask
+        if ( 0 == result && 0 != ::fchmod( output.get(), mode ) )
+        {
+            result = errno;
+        }
+
+        if ( 0 != result )
+        {
+            ::unlink( destinationString.c_str() );
+            error.assign( result, std::system_category() );
+
+            return false;
+        }
+    }
+    catch ( const std::bad_alloc & )
+    {
+        error = std::make_error_code( std::errc::not_enough_memory );
+
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Move a file.
+ *
+ * \param source          The file to move.
+ * \param destination     The new path of the file, replaced if it exists.
+ *
+ * \return \c true if the file was successfully moved, \c false otherwise.
+ *
+ * \sa moveFile( const FilePath &, const FilePath &, std::error_code & )
+ */
+bool moveFile( const FilePath & source, const FilePath & destination )
+{
+    std::error_code error;
+
+    return moveFile( source, destination, error );
+}
+
+/*!
+ * \brief Move a file.
+ *
+ * Renames the file, or copies it and removes \p source when the destination is on
+ * another file system.
+ *
+ * \param source          The file to move.
+ * \param destination     The new path of the file, replaced if it exists.
+ * \param error           Receives the reason of the failure, cleared on success.
+ *
+ * \return \c true if the file was successfully moved, \c false otherwise.
+ */
+bool moveFile( const FilePath & source, const FilePath & destination, std::error_code & error ) noexcept
+{
+    error.clear();
+
+    try
+    {
+        const std::string sourceString( source.toString() );
+
+        if ( 0 == ::rename( sourceString.c_str(), std::string( destination.toString() ).c_str() ) )
+        {
+            return true;
+        }
+
+        if ( EXDEV != errno )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+
+        if ( ! copyFile( source, destination, error ) )
+        {
+            return false;
+        }
+
+        if ( 0 != ::unlink( sourceString.c_str() ) )
+        {
+            error.assign( errno, std::system_category() );
+
+            return false;
+        }
+    }
+    catch ( const std::bad_alloc & )
+    {
+        error = std::make_error_code( std::errc::not_enough_memory );
+
+        return false;
+    }
+
+    return true;
+}
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
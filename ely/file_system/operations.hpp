@@ -0,0 +1,47 @@
+/*!
+ * \file operations.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file for the copy and the move of the files.
+ *
+ * The data is copied by the kernel, without passing through the user space :
+ * with \e copy_file_range , which can share the blocks or copy them on the server side
+ * for the file systems supporting it, else with \e sendfile . A loop of large reads and
+ * writes is only used when both are unsupported.
+ */
+#ifndef OPERATIONS_HPP
+#define OPERATIONS_HPP
+
+
+#include <system_error>
+
+
+#include "ely/config.hpp"
+#include "ely/file_system/FilePath.hpp"
+
+
+#if defined ( ELY_POSIX_API )
+
+
+namespace ely
+{
+namespace file_system
+{
+
+
+bool copyFile( const FilePath & source, const FilePath & destination );
+bool copyFile( const FilePath & source, const FilePath & destination, std::error_code & error ) noexcept;
+
+bool moveFile( const FilePath & source, const FilePath & destination );
+bool moveFile( const FilePath & source, const FilePath & destination, std::error_code & error ) noexcept;
+
+
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+
+#endif // ELY_POSIX_API
+
+
+#endif // OPERATIONS_HPP
@@ -0,0 +1,390 @@
+#include "ely/file_system/separators.hpp"
+
+
+#include <atomic>
+
+
+#if defined ( ELY_USING_X86_SIMD )
+#   include <immintrin.h>
+#endif
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace separators
+{
+namespace
+{
+
+
+/// The functions of a kernel.
+struct Functions
+{
+    Kernel kernel;
+    std::size_t ( *findFirst )( const char *, std::size_t, char, char ) noexcept;
+    std::size_t ( *findLast )( const char *, std::size_t, char, char ) noexcept;
+    void ( *replace )( char *, std::size_t, char, char ) noexcept;
+};
+
+
+//
+// Scalar kernel
+//
+
+std::size_t findFirstScalar( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    for ( std::size_t i = 0; i < size; ++i )
+    {
+        if ( first == data[ i ] || second == data[ i ] )
+        {
+            return i;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+std::size_t findLastScalar( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    for ( std::size_t i = size; 0 < i; --i )
+    {
+        if ( first == data[ i - 1 ] || second == data[ i - 1 ] )
+        {
+            return i - 1;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+void replaceScalar( char * data, std::size_t size, char from, char to ) noexcept
+{
+    for ( std::size_t i = 0; i < size; ++i )
+    {
+        if ( from == data[ i ] )
+        {
+            data[ i ] = to;
+        }
+    }
+}
+
+constexpr Functions scalarFunctions { Kernel::Scalar, &findFirstScalar, &findLastScalar, &replaceScalar };
+
+
+#if defined ( ELY_USING_X86_SIMD )
+
+//
+// SSE2 kernel : 16 characters at once
+//
+
+__attribute__(( target( "sse2" ) ))
+std::size_t findFirstSse2( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    const __m128i firstSeparators = _mm_set1_epi8( first );
+    const __m128i secondSeparators = _mm_set1_epi8( second );
+    std::size_t i = 0;
+
+    for ( ; i + 16 <= size; i += 16 )
+    {
+        const __m128i characters = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i ) );
+        const int mask = _mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( characters, firstSeparators ),
+                                                          _mm_cmpeq_epi8( characters, secondSeparators ) ) );
+
+        if ( 0 != mask )
+        {
+            return i + __builtin_ctz( mask );
+        }
+    }
+
+    const std::size_t position = findFirstScalar( data + i, size - i, first, second );
+
+    return ( std::string_view::npos != position ) ? i + position : position;
+}
+
+__attribute__(( target( "sse2" ) ))
+std::size_t findLastSse2( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    const __m128i firstSeparators = _mm_set1_epi8( first );
+    const __m128i secondSeparators = _mm_set1_epi8( second );
+    std::size_t i = size;
+
+    for ( ; 16 <= i; i -= 16 )
+    {
+        const __m128i characters = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i - 16 ) );
+        const int mask = _mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( characters, firstSeparators ),
+                                                          _mm_cmpeq_epi8( characters, secondSeparators ) ) );
+
+        if ( 0 != mask )
+        {
+            return i - 16 + ( 31 - __builtin_clz( mask ) );
+        }
+    }
+
+    return findLastScalar( data, i, first, second );
+}
+
+__attribute__(( target( "sse2" ) ))
+void replaceSse2( char * data, std::size_t size, char from, char to ) noexcept
+{
+    const __m128i fromSeparators = _mm_set1_epi8( from );
+    const __m128i toSeparators = _mm_set1_epi8( to );
+    std::size_t i = 0;
+
+    for ( ; i + 16 <= size; i += 16 )
+    {
+        __m128i * const block = reinterpret_cast< __m128i * >( data + i );
+        const __m128i characters = _mm_loadu_si128( block );
+        const __m128i isSeparator = _mm_cmpeq_epi8( characters, fromSeparators );
+
+        _mm_storeu_si128( block, _mm_or_si128( _mm_and_si128( isSeparator, toSeparators ),
+                                               _mm_andnot_si128( isSeparator, characters ) ) );
+    }
+
+    replaceScalar( data + i, size - i, from, to );
+}
+
+constexpr Functions sse2Functions { Kernel::Sse2, &findFirstSse2, &findLastSse2, &replaceSse2 };
+
+
+//
+// AVX2 kernel : 32 characters at once
+//
+
+__attribute__(( target( "avx2" ) ))
+std::size_t findFirstAvx2( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    const __m256i firstSeparators = _mm256_set1_epi8( first );
+    const __m256i secondSeparators = _mm256_set1_epi8( second );
+    std::size_t i = 0;
+
+    for ( ; i + 32 <= size; i += 32 )
+    {
+        const __m256i characters = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + i ) );
+        const unsigned int mask = static_cast< unsigned int >(
+            _mm256_movemask_epi8( _mm256_or_si256( _mm256_cmpeq_epi8( characters, firstSeparators ),
+                                                   _mm256_cmpeq_epi8( characters, secondSeparators ) ) ) );
+
+        if ( 0 != mask )
+        {
+            return i + __builtin_ctz( mask );
+        }
+    }
+
+    // The tail is shorter than a block of the SSE2 kernel most of the time
+    const std::size_t position = findFirstSse2( data + i, size - i, first, second );
+
+    return ( std::string_view::npos != position ) ? i + position : position;
+}
+
+__attribute__(( target( "avx2" ) ))
+std::size_t findLastAvx2( const char * data, std::size_t size, char first, char second ) noexcept
+{
+    const __m256i firstSeparators = _mm256_set1_epi8( first );
+    const __m256i secondSeparators = _mm256_set1_epi8( second );
+    std::size_t i = size;
+
+    for ( ; 32 <= i; i -= 32 )
+    {
+        const __m256i characters = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + i - 32 ) );
+        const unsigned int mask = static_cast< unsigned int >(
+            _mm256_movemask_epi8( _mm256_or_si256( _mm256_cmpeq_epi8( characters, firstSeparators ),
+                                                   _mm256_cmpeq_epi8( characters, secondSeparators ) ) ) );
+
+        if ( 0 != mask )
+        {
+            return i - 32 + ( 31 - __builtin_clz( mask ) );
+        }
+    }
+
+    return findLastSse2( data, i, first, second );
+}
+
+__attribute__(( target( "avx2" ) ))
+void replaceAvx2( char * data, std::size_t size, char from, char to ) noexcept
+{
+    const __m256i fromSeparators = _mm256_set1_epi8( from );
+    const __m256i toSeparators = _mm256_set1_epi8( to );
+    std::size_t i = 0;
+
+    for ( ; i + 32 <= size; i += 32 )
+    {
+        __m256i * const block = reinterpret_cast< __m256i * >( data + i );
+        const __m256i characters = _mm256_loadu_si256( block );
+
+        _mm256_storeu_si256( block, _mm256_blendv_epi8( characters,
+                                                        toSeparators,
+                                                        _mm256_cmpeq_epi8( characters, fromSeparators ) ) );
+    }
+
+    replaceSse2( data + i, size - i, from, to );
+}
+
+constexpr Functions avx2Functions { Kernel::Avx2, &findFirstAvx2, &findLastAvx2, &replaceAvx2 };
+
+#endif // x86 SIMD
+
+
+/*!
+ * \brief Get the functions of a kernel.
+ *
+ * \param kernel  The kernel.
+ *
+ * \return The functions of \p kernel , \c nullptr if the processor doesn't support it.
+ */
+const Functions * getFunctions( Kernel kernel ) noexcept
+{
+    switch ( kernel )
+    {
+#if defined ( ELY_USING_X86_SIMD )
+    case Kernel::Avx2 :
+        return __builtin_cpu_supports( "avx2" ) ? &avx2Functions : nullptr;
+
+    case Kernel::Sse2 :
+        return __builtin_cpu_supports( "sse2" ) ? &sse2Functions : nullptr;
+#endif
+
+    case Kernel::Scalar :
+        return &scalarFunctions;
+
+    default :
+        return nullptr;
+    }
+}
+
+/*!
+ * \brief Get the functions of the selected kernel.
+ *
+ * The best kernel supported by the processor is selected on the first call.
+ *
+ * \return The selected functions.
+ */
+std::atomic< const Functions * > & getSelectedFunctions() noexcept
+{
+    static std::atomic< const Functions * > selectedFunctions( [] () noexcept
+    {
+        for ( Kernel kernel : { Kernel::Avx2, Kernel::Sse2 } )
+        {
+            if ( const Functions * functions = getFunctions( kernel ) )
+            {
+                return functions;
+            }
+        }
+
+        return &scalarFunctions;
+    }() );
+
+    return selectedFunctions;
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The functions of the selected kernel.
+ */
+inline const Functions & functions() noexcept
+{
+    return *getSelectedFunctions().load( std::memory_order_relaxed );
+}
+
+
+} // namespace
+
+
+/*!
+ * \brief Find the first separator.
+ *
+ * \param pathString  The path in which the separator will be look for.
+ * \param first       A separator.
+ * \param second      Another separator, can be the same as \p first .
+ * \param from        The position from which to look for.
+ *
+ * \return The position of the first separator from \p from , \c std::string_view::npos if there is none.
+ */
+std::size_t findFirst( std::string_view pathString, char first, char second, std::size_t from ) noexcept
+{
+    if ( from >= pathString.size() )
+    {
+        return std::string_view::npos;
+    }
+
+    const std::size_t position = functions().findFirst( pathString.data() + from, pathString.size() - from, first, second );
+
+    return ( std::string_view::npos != position ) ? from + position : position;
+}
+
+/*!
+ * \brief Find the last separator.
+ *
+ * \param pathString  The path in which the separator will be look for.
+ * \param first       A separator.
+ * \param second      Another separator, can be the same as \p first .
+ *
+ * \return The position of the last separator, \c std::string_view::npos if there is none.
+ */
+std::size_t findLast( std::string_view pathString, char first, char second ) noexcept
+{
+    return functions().findLast( pathString.data(), pathString.size(), first, second );
+}
+
+/*!
+ * \brief Replace a separator by another one.
+ *
+ * \param pathString  The path in which the separators are replaced.
+ * \param size        The size of \p pathString .
+ * \param from        The separator to replace.
+ * \param to          The replacing separator.
+ */
+void replace( char * pathString, std::size_t size, char from, char to ) noexcept
+{
+    functions().replace( pathString, size, from, to );
+}
+
+/*!
+ * \brief Accessor
+ *
+ * \return The selected kernel.
+ */
+Kernel getKernel() noexcept
+{
+    return functions().kernel;
+}
+
+/*!
+ * \brief Check if the processor supports a kernel.
+ *
+ * \param kernel  The kernel to check.
+ *
+ * \return \c true if \p kernel can be selected, \c false otherwise.
+ */
+bool isSupported( Kernel kernel ) noexcept
+{
+    return nullptr != getFunctions( kernel );
+}
+
+/*!
+ * \brief Select the kernel used by every thread.
+ *
+ * Only useful to compare or test the kernels, the best one is selected by default.
+ *
+ * \param kernel  The kernel to select.
+ *
+ * \return \c true if \p kernel was selected, \c false if the processor doesn't support it.
+ */
+bool setKernel( Kernel kernel ) noexcept
+{
+    const Functions * selectedFunctions = getFunctions( kernel );
+
+    if ( nullptr != selectedFunctions )
+    {
+        getSelectedFunctions().store( selectedFunctions, std::memory_order_relaxed );
+    }
+
+    return nullptr != selectedFunctions;
+}
+
+
+} // namespace ::ely::file_system::separators
+} // namespace ::ely::file_system
+} // namespace ::ely
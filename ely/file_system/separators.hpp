@@ -0,0 +1,54 @@
+/*!
+ * \file separators.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file for the separators' kernels.
+ *
+ * Provides vectorized functions to find and replace the directory separators,
+ * used by the parsing functions of the paths.\n
+ * The best kernel supported by the processor is selected at run time :
+ * AVX2, SSE2 or a scalar fallback.
+ */
+#ifndef SEPARATORS_HPP
+#define SEPARATORS_HPP
+
+
+#include <cstddef>
+#include <string_view>
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace file_system
+{
+namespace separators
+{
+
+
+/// The implementations of the kernels.
+enum class Kernel
+{
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+
+std::size_t findFirst( std::string_view pathString, char first, char second, std::size_t from = 0 ) noexcept;
+std::size_t findLast( std::string_view pathString, char first, char second ) noexcept;
+void replace( char * pathString, std::size_t size, char from, char to ) noexcept;
+
+Kernel getKernel() noexcept;
+bool isSupported( Kernel kernel ) noexcept;
+bool setKernel( Kernel kernel ) noexcept;
+
+
+} // namespace ::ely::file_system::separators
+} // namespace ::ely::file_system
+} // namespace ::ely
+
+#endif // SEPARATORS_HPP
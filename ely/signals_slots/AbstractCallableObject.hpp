@@ -9,6 +9,7 @@
 #define ABSTRACT_CALLABLE_OBJECT_HPP
 
 
+#include <mutex>
 #include <vector>
 
 
@@ -21,7 +22,9 @@ namespace signals_slots
 {
 
 
+template < typename ... Args > class AbstractSignal;
 template < typename ... Args > class Signal;
+template < typename ... Args > class BlockableSignal;
 
 
 template < typename ... Args >
@@ -41,7 +44,17 @@ template < typename ... Args >
  * If a slot isn't bound, it does nothing.\n\n
  *
  * The signals/slots connected to a signal are called in the same order
- * as they were connected.
+ * as they were connected.\n\n
+ *
+ * Connections are thread-safe : \c connect(), \c disconnect(), emissions and
+ * the destruction of a callable object can happen concurrently from different threads.\n
+ * Once \c disconnect() returns, or once the destructor of a callable object has
+ * returned, no call of the callable object by the signal starts anymore.
+ * While the destructor waits for a signal busy emitting, this emission can still
+ * call the object : the destructor returns once the call is finished.\n
+ * A signal holds its lock while it calls its connected objects, so emissions of
+ * a same signal are serialized and a slot must not connect or disconnect another
+ * signal which can be emitted concurrently by another thread.
  *
  * Example of use :
  * \code
@@ -127,8 +140,9 @@ class AbstractCallableObject
 {
 public:
     friend class Signal< Args ... >;
-    friend void connect< Args ... >( Signal< Args ... > &, AbstractCallableObject< Args ... > & );
-    friend void disconnect< Args ... >( Signal< Args ... > &, AbstractCallableObject< Args ... > & );
+    friend class BlockableSignal< Args ... >;
+    friend void connect< Args ... >( AbstractSignal< Args ... > &, AbstractCallableObject< Args ... > & );
+    friend void disconnect< Args ... >( AbstractSignal< Args ... > &, AbstractCallableObject< Args ... > & );
 
 
 
@@ -144,12 +158,27 @@ public:
      */
     virtual void operator ()( Args ... args ) const = 0;
 
+protected:
+    /// The type of the lock protecting the connections of a callable object.
+    typedef ::std::recursive_mutex Mutex;
+
+
+    AbstractCallableObject() = default;
+    AbstractCallableObject( const AbstractCallableObject & ) = delete;
+    AbstractCallableObject & operator =( const AbstractCallableObject & ) = delete;
+
+
+    void disconnectCallers();
+
+
+    mutable Mutex myMutex;
+
 private:
-    void addCaller( Signal< Args ... > & caller );
-    void removeCaller( Signal< Args ... > & caller );
+    void addCaller( AbstractSignal< Args ... > & caller );
+    void removeCaller( AbstractSignal< Args ... > & caller );
 
 
-    ::std::vector< Signal< Args ... > * > myCallerObjects;
+    ::std::vector< AbstractSignal< Args ... > * > myCallerObjects;
 };
 
 
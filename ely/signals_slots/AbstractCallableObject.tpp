@@ -6,9 +6,10 @@
  * \brief Source file of the AbstractCallableObject class.
 */
 #include <algorithm>
+#include <thread>
 
 
-//#include "ely/signals_slots/Signal.hpp"
+#include "ely/signals_slots/AbstractSignal.hpp"
 
 
 namespace ely
@@ -28,12 +29,57 @@ template < typename ... Args >
  * \brief Destructor
  * 
  * When a callable object is destroyed it tells to every connected callable object to remove it.
+ *
+ * \sa disconnectCallers()
  */
 AbstractCallableObject< Args ... >::~AbstractCallableObject()
 {
-    for ( auto caller : myCallerObjects )
+    disconnectCallers();
+}
+
+
+//------------------------------------------//
+//                                          //
+//            Protected functions           //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Disconnect the object from every signal calling it.
+ *
+ * Must be called by the destructor of the final classes, before their members are destroyed,
+ * so that a concurrent emission can't call a partially destroyed object.\n
+ * When the function returns, no signal is calling the object anymore.
+ *
+ * The lock of the object is held while trying the lock of the signal, so the signal can't be
+ * destroyed in the meantime. If the signal is busy, for example emitting, every lock is released
+ * before trying again to avoid a deadlock with the emission.
+ */
+void AbstractCallableObject< Args ... >::disconnectCallers()
+{
+    for ( ; ; )
     {
-        caller->removeCalled( *this );
+        ::std::unique_lock< Mutex > lock( myMutex );
+
+        if ( myCallerObjects.empty() )
+        {
+            return;
+        }
+
+        AbstractSignal< Args ... > & caller = *myCallerObjects.back();
+        ::std::unique_lock< Mutex > callerLock( caller.myMutex, ::std::try_to_lock );
+
+        if ( callerLock.owns_lock() )
+        {
+            caller.removeCalled( *this );
+            myCallerObjects.pop_back();
+        }
+        else
+        {
+            lock.unlock();
+            ::std::this_thread::yield();
+        }
     }
 }
 
@@ -50,7 +96,7 @@ template < typename ... Args >
  * 
  * \param callableObject The callable object to add.
  */
-void AbstractCallableObject< Args ... >::addCaller( Signal< Args ... > & caller )
+void AbstractCallableObject< Args ... >::addCaller( AbstractSignal< Args ... > & caller )
 {
     if ( myCallerObjects.end() == ::std::find( myCallerObjects.begin(), myCallerObjects.end(), &caller ) )
     {
@@ -64,7 +110,7 @@ template < typename ... Args >
  * 
  * \param callableObject The callable object to remove.
  */
-void AbstractCallableObject< Args ... >::removeCaller( Signal< Args ... > & caller )
+void AbstractCallableObject< Args ... >::removeCaller( AbstractSignal< Args ... > & caller )
 {
     auto it = ::std::find( myCallerObjects.begin(),
                            myCallerObjects.end(),
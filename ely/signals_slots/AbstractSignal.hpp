@@ -0,0 +1,69 @@
+/*!
+ * \file AbstractSignal.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the AbstractSignal class.
+ */
+#ifndef ABSTRACT_SIGNAL_HPP
+#define ABSTRACT_SIGNAL_HPP
+
+
+#include "ely/signals_slots/AbstractCallableObject.hpp"
+#include "ely/signals_slots/connect.hpp"
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+template < typename ... Args >
+/*!
+ * \brief The AbstractSignal class
+ *
+ * The base implementation for a signal, the callable object which calls the objects
+ * connected to it.\n
+ * Each kind of signal stores its connections in its own way : a \c Signal keeps only
+ * the called objects, a \c BlockableSignal also keeps how many times each of them is blocked.
+ *
+ * \sa Signal
+ * \sa BlockableSignal
+ */
+class AbstractSignal : public AbstractCallableObject< Args ... >
+{
+public:
+    friend class AbstractCallableObject< Args ... >;
+    friend void connect< Args ... >( AbstractSignal< Args ... > &, AbstractCallableObject< Args ... > & );
+    friend void disconnect< Args ... >( AbstractSignal< Args ... > &, AbstractCallableObject< Args ... > & );
+
+protected:
+    AbstractSignal() = default;
+
+private:
+    /*!
+     * \brief Add an object to the objects called by the signal.
+     *
+     * Called with the locks of the signal and of \p called held.
+     *
+     * \param called The object to call.
+     */
+    virtual void addCalled( AbstractCallableObject< Args ... > & called ) = 0;
+
+    /*!
+     * \brief Remove an object from the objects called by the signal.
+     *
+     * Called with the locks of the signal and of \p called held.
+     *
+     * \param called The object to not call anymore.
+     */
+    virtual void removeCalled( AbstractCallableObject< Args ... > & called ) = 0;
+};
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#endif // ABSTRACT_SIGNAL_HPP
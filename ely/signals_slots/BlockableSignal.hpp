@@ -0,0 +1,120 @@
+/*!
+ * \file BlockableSignal.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the BlockableSignal class.
+ */
+#ifndef BLOCKABLE_SIGNAL_HPP
+#define BLOCKABLE_SIGNAL_HPP
+
+
+#include <vector>
+
+
+#include "ely/signals_slots/AbstractSignal.hpp"
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+template < typename ... Args >
+/*!
+ * \brief The BlockableSignal class
+ *
+ * A signal which can be blocked, as a whole or only one of its connections, to
+ * temporarily stop calling the connected objects without disconnecting them.\n
+ * Otherwise it works as a \c Signal .\n\n
+ *
+ * Each connection stores its block count next to the called object and each
+ * emission checks the counts : use a \c Signal when no blocking is needed.
+ *
+ * \sa Signal
+ * \sa SignalBlocker
+ */
+class BlockableSignal final : public AbstractSignal< Args ... >
+{
+public:
+    friend void block< Args ... >( BlockableSignal< Args ... > &, AbstractCallableObject< Args ... > & );
+    friend void unblock< Args ... >( BlockableSignal< Args ... > &, AbstractCallableObject< Args ... > & );
+    friend bool isBlocked< Args ... >( const BlockableSignal< Args ... > &, const AbstractCallableObject< Args ... > & );
+
+
+    BlockableSignal() = default;
+    ~BlockableSignal();
+
+
+    void operator ()( Args ... args ) const override;
+
+
+    void block();
+    void unblock();
+    bool isBlocked() const;
+
+private:
+    class EmissionGuard;
+
+    /// A connection to a called object.
+    struct Connection
+    {
+        /// The called object, \c nullptr when disconnected while the signal is emitting.
+        AbstractCallableObject< Args ... > * called;
+        /// The number of blocks of the connection, the object is called only if it is \c 0 .
+        unsigned int blockCount;
+    };
+
+    typedef ::std::vector< Connection > Connections;
+
+
+    /// The block count of a connection disconnected while the signal is emitting.
+    static constexpr unsigned int disconnectedBlockCount() noexcept;
+
+
+    void disconnectCalled();
+    typename Connections::iterator findCalled( const AbstractCallableObject< Args ... > & called ) const;
+    void addCalled( AbstractCallableObject< Args ... > & called ) override;
+    void removeCalled( AbstractCallableObject< Args ... > & called ) override;
+
+
+    mutable Connections myCalledObjects;
+    /// The number of blocks of the whole signal.
+    unsigned int myBlockCount = 0;
+    /// The number of nested emissions in progress.
+    mutable unsigned int myEmissionDepth = 0;
+    /// Whether an object has been disconnected while the signal was emitting.
+    mutable bool myHasDisconnectedCalled = false;
+};
+
+
+template < typename ... Args >
+/*!
+ * \brief Keeps track of the emissions in progress.
+ *
+ * Removes the disconnected objects from the list when the outermost emission ends,
+ * even if a called object throws.
+ */
+class BlockableSignal< Args ... >::EmissionGuard
+{
+public:
+    explicit EmissionGuard( const BlockableSignal & aSignal ) noexcept;
+    ~EmissionGuard();
+
+    EmissionGuard( const EmissionGuard & ) = delete;
+    EmissionGuard & operator =( const EmissionGuard & ) = delete;
+
+private:
+    const BlockableSignal & mySignal;
+};
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#include "ely/signals_slots/BlockableSignal.tpp"
+
+
+#endif // BLOCKABLE_SIGNAL_HPP
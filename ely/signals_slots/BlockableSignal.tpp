@@ -0,0 +1,248 @@
+/*!
+ * \file BlockableSignal.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the BlockableSignal class.
+*/
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Destructor
+ *
+ * Disconnects the signal from every connected objects and from every signals calling it.
+ */
+BlockableSignal< Args ... >::~BlockableSignal()
+{
+    disconnectCalled();
+    this->disconnectCallers();
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief operator ()
+ * 
+ * Call every connected signals/slots with the needed information.
+ * 
+ * \param args  The information to transmit to the signals/slots.
+ */
+void BlockableSignal< Args ... >::operator ()( Args ... args ) const
+{
+    ::std::lock_guard< typename BlockableSignal::Mutex > lock( this->myMutex );
+
+    if ( 0 != myBlockCount )
+    {
+        return;
+    }
+
+    EmissionGuard emission( *this );
+
+    // Objects connected during the emission are only called by the next ones
+    const auto size = myCalledObjects.size();
+
+    for ( typename Connections::size_type i = 0; i < size; ++i )
+    {
+        const Connection & connection = myCalledObjects[ i ];
+
+        // Blocked and disconnected connections are skipped with the same test
+        if ( 0 == connection.blockCount )
+        {
+            (*connection.called)( args ... );
+        }
+    }
+}
+
+template < typename ... Args >
+/*!
+ * \brief Block the signal.
+ *
+ * While the signal is blocked, emitting it calls nothing.\n
+ * The blocks are counted : the signal must be unblocked as many times as it was blocked.
+ *
+ * \sa unblock()
+ * \sa SignalBlocker
+ */
+void BlockableSignal< Args ... >::block()
+{
+    ::std::lock_guard< typename BlockableSignal::Mutex > lock( this->myMutex );
+
+    ++myBlockCount;
+}
+
+template < typename ... Args >
+/*!
+ * \brief Unblock the signal.
+ *
+ * Cancels one call of \c block() , does nothing if the signal is not blocked.
+ *
+ * \sa block()
+ */
+void BlockableSignal< Args ... >::unblock()
+{
+    ::std::lock_guard< typename BlockableSignal::Mutex > lock( this->myMutex );
+
+    if ( 0 != myBlockCount )
+    {
+        --myBlockCount;
+    }
+}
+
+template < typename ... Args >
+/*!
+ * \brief Check if the signal is blocked.
+ *
+ * \return \c true if the signal is blocked, \c false otherwise.
+ */
+bool BlockableSignal< Args ... >::isBlocked() const
+{
+    ::std::lock_guard< typename BlockableSignal::Mutex > lock( this->myMutex );
+
+    return 0 != myBlockCount;
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Private functions            //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+constexpr unsigned int BlockableSignal< Args ... >::disconnectedBlockCount() noexcept
+{
+    return ~0u;
+}
+
+template < typename ... Args >
+/*!
+ * \brief Disconnect every objects called by the signal.
+ *
+ * Works as \c AbstractCallableObject::disconnectCallers() : the called object is only
+ * locked with a try so a concurrent emission of the called object can't lead to a deadlock.
+ */
+void BlockableSignal< Args ... >::disconnectCalled()
+{
+    for ( ; ; )
+    {
+        ::std::unique_lock< typename BlockableSignal::Mutex > lock( this->myMutex );
+
+        if ( myCalledObjects.empty() )
+        {
+            return;
+        }
+
+        AbstractCallableObject< Args ... > & called = *myCalledObjects.back().called;
+        ::std::unique_lock< typename BlockableSignal::Mutex > calledLock( called.myMutex, ::std::try_to_lock );
+
+        if ( calledLock.owns_lock() )
+        {
+            called.removeCaller( *this );
+            myCalledObjects.pop_back();
+        }
+        else
+        {
+            lock.unlock();
+            ::std::this_thread::yield();
+        }
+    }
+}
+
+template < typename ... Args >
+/*!
+ * \brief Find the connection to an object.
+ *
+ * \param called The connected object to look for.
+ *
+ * \return An iterator on the connection, the end of the connections if \p called is not connected.
+ */
+typename BlockableSignal< Args ... >::Connections::iterator
+BlockableSignal< Args ... >::findCalled( const AbstractCallableObject< Args ... > & called ) const
+{
+    return ::std::find_if( myCalledObjects.begin(),
+                           myCalledObjects.end(),
+                           [ &called ]( const Connection & connection ) { return &called == connection.called; } );
+}
+
+template < typename ... Args >
+void BlockableSignal< Args ... >::addCalled( AbstractCallableObject< Args ... > & called )
+{
+    if ( myCalledObjects.end() == findCalled( called ) )
+    {
+        myCalledObjects.push_back( Connection{ &called, 0 } );
+    }
+}
+
+template < typename ... Args >
+void BlockableSignal< Args ... >::removeCalled( AbstractCallableObject< Args ... > & called )
+{
+    auto it = findCalled( called );
+
+    if ( myCalledObjects.end() != it )
+    {
+        if ( 0 == myEmissionDepth )
+        {
+            myCalledObjects.erase( it );
+        }
+        else // The emission in progress iterates over the list
+        {
+            *it = Connection{ nullptr, disconnectedBlockCount() };
+            myHasDisconnectedCalled = true;
+        }
+    }
+}
+
+
+//------------------------------------------//
+//                                          //
+//              EmissionGuard               //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+inline BlockableSignal< Args ... >::EmissionGuard::EmissionGuard( const BlockableSignal & aSignal ) noexcept
+    : mySignal( aSignal )
+{
+    ++mySignal.myEmissionDepth;
+}
+
+template < typename ... Args >
+BlockableSignal< Args ... >::EmissionGuard::~EmissionGuard()
+{
+    if ( 0 == --mySignal.myEmissionDepth && mySignal.myHasDisconnectedCalled )
+    {
+        auto & calledObjects = mySignal.myCalledObjects;
+
+        calledObjects.erase( ::std::remove_if( calledObjects.begin(),
+                                               calledObjects.end(),
+                                               []( const Connection & connection ) { return nullptr == connection.called; } ),
+                             calledObjects.end() );
+        mySignal.myHasDisconnectedCalled = false;
+    }
+}
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
@@ -0,0 +1,192 @@
+/*!
+ * \file Serializer.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the Serializer struct.
+ *
+ * Binary serialization of the arguments of a signal, used to record and replay signals.
+ */
+#ifndef SERIALIZER_HPP
+#define SERIALIZER_HPP
+
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+template < typename T, typename Enable = void >
+/*!
+ * \brief The Serializer struct
+ *
+ * Writes a value of type \c T in a binary stream and reads it back.\n
+ * Arithmetic types, enumerations and \c std::string are supported,
+ * the other types must specialize the struct :
+ * \code
+ * namespace ely
+ * {
+ * namespace signals_slots
+ * {
+ *
+ * template <>
+ * struct Serializer< Message >
+ * {
+ *     static void write( ::std::ostream & os, const Message & message )
+ *     {
+ *         Serializer< ::std::string >::write( os, message.text );
+ *     }
+ *
+ *     static void read( ::std::istream & is, Message & message )
+ *     {
+ *         Serializer< ::std::string >::read( is, message.text );
+ *     }
+ * };
+ *
+ * } // namespace ::ely::signals_slots
+ * } // namespace ::ely
+ * \endcode
+ *
+ * A read error must be reported by the state of the stream.\n
+ * The values are written in the byte order of the machine.
+ */
+struct Serializer;
+
+
+namespace detail
+{
+
+
+/*!
+ * \brief Write an unsigned integer with a variable length.
+ *
+ * Uses 7 bits per byte, the high bit tells if another byte follows.
+ *
+ * \param os    The stream to write in.
+ * \param value The value to write.
+ */
+inline void writeVarint( ::std::ostream & os, ::std::uint64_t value )
+{
+    while ( 0x80 <= value )
+    {
+        os.put( static_cast< char >( ( value & 0x7F ) | 0x80 ) );
+        value >>= 7;
+    }
+
+    os.put( static_cast< char >( value ) );
+}
+
+/*!
+ * \brief Read an unsigned integer written by \c writeVarint() .
+ *
+ * \param is    The stream to read from.
+ * \param value The variable receiving the value.
+ *
+ * \return \c true if the value was read, \c false otherwise.
+ */
+inline bool readVarint( ::std::istream & is, ::std::uint64_t & value )
+{
+    value = 0;
+
+    for ( unsigned int shift = 0; shift < 64; shift += 7 )
+    {
+        const auto byte = is.get();
+
+        if ( ::std::istream::traits_type::eof() == byte )
+        {
+            return false;
+        }
+
+        value |= static_cast< ::std::uint64_t >( byte & 0x7F ) << shift;
+
+        if ( 0 == ( byte & 0x80 ) )
+        {
+            return true;
+        }
+    }
+
+    is.setstate( ::std::ios_base::failbit );
+
+    return false;
+}
+
+
+} // namespace ::ely::signals_slots::detail
+
+
+template < typename T >
+/// Serializer of the arithmetic types and the enumerations.
+struct Serializer< T, typename ::std::enable_if< ::std::is_arithmetic< T >::value || ::std::is_enum< T >::value >::type >
+{
+    static void write( ::std::ostream & os, const T & value )
+    {
+        os.write( reinterpret_cast< const char * >( &value ), sizeof( T ) );
+    }
+
+    static void read( ::std::istream & is, T & value )
+    {
+        is.read( reinterpret_cast< char * >( &value ), sizeof( T ) );
+    }
+};
+
+template <>
+/*!
+ * \brief Serializer of the strings : the size followed by the characters.
+ *
+ * The size read is not trusted : the characters are read by chunks, so a corrupted
+ * size can't allocate more than the bytes really left in the stream.
+ */
+struct Serializer< ::std::string >
+{
+    static void write( ::std::ostream & os, const ::std::string & value )
+    {
+        detail::writeVarint( os, value.size() );
+        os.write( value.data(), static_cast< ::std::streamsize >( value.size() ) );
+    }
+
+    static void read( ::std::istream & is, ::std::string & value )
+    {
+        ::std::uint64_t size = 0;
+
+        value.clear();
+
+        if ( ! detail::readVarint( is, size ) )
+        {
+            is.setstate( ::std::ios_base::failbit );
+
+            return;
+        }
+
+        char chunk[ 4096 ];
+
+        while ( 0 != size )
+        {
+            const auto chunkSize = static_cast< ::std::streamsize >( ::std::min< ::std::uint64_t >( size, sizeof( chunk ) ) );
+
+            // A short read sets the failbit : the record is truncated or the size is corrupted
+            if ( ! is.read( chunk, chunkSize ) )
+            {
+                return;
+            }
+
+            value.append( chunk, static_cast< ::std::string::size_type >( chunkSize ) );
+            size -= static_cast< ::std::uint64_t >( chunkSize );
+        }
+    }
+};
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#endif // SERIALIZER_HPP
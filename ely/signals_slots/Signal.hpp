@@ -12,8 +12,7 @@
 #include <vector>
 
 
-#include "ely/signals_slots/AbstractCallableObject.hpp"
-#include "ely/signals_slots/connect.hpp"
+#include "ely/signals_slots/AbstractSignal.hpp"
 
 
 namespace ely
@@ -30,27 +29,61 @@ template < typename ... Args >
  * A signal is a template object defined by its template parameters.\n
  * It can be connected to any slot with the same template parameters.\n
  * Each time a signal is emit, with the function <em>operator ()</em>,
- *      every slot connected are called.
+ *      every slot connected are called.\n\n
+ *
+ * A connected object can be disconnected while the signal is emitting, even
+ * from the called object itself : it is not called anymore by the current emission.\n
+ * An object connected while the signal is emitting is only called by the next emissions.\n\n
+ *
+ * A signal can't be blocked, use a \c BlockableSignal to mute it without disconnecting.
+ *
+ * \sa BlockableSignal
  */
-class Signal final : public AbstractCallableObject< Args ... >
+class Signal final : public AbstractSignal< Args ... >
 {
 public:
-    friend AbstractCallableObject< Args ... >::~AbstractCallableObject();
-    friend void connect< Args ... >( Signal< Args ... > &, AbstractCallableObject< Args ... > & );
-    friend void disconnect< Args ... >( Signal< Args ... > &, AbstractCallableObject< Args ... > & );
-
-
+    Signal() = default;
     ~Signal();
 
 
     void operator ()( Args ... args ) const override;
 
 private:
-    void addCalled( AbstractCallableObject< Args ... > & called );
-    void removeCalled( AbstractCallableObject< Args ... > & called );
+    class EmissionGuard;
+
+
+    void disconnectCalled();
+    void addCalled( AbstractCallableObject< Args ... > & called ) override;
+    void removeCalled( AbstractCallableObject< Args ... > & called ) override;
+
+
+    /// The connected objects, a disconnected object is set to \c nullptr while the signal is emitting.
+    mutable ::std::vector< AbstractCallableObject< Args ... > * > myCalledObjects;
+    /// The number of nested emissions in progress.
+    mutable unsigned int myEmissionDepth = 0;
+    /// Whether an object has been disconnected while the signal was emitting.
+    mutable bool myHasDisconnectedCalled = false;
+};
 
 
-    ::std::vector< AbstractCallableObject< Args ... > * > myCalledObjects;
+template < typename ... Args >
+/*!
+ * \brief Keeps track of the emissions in progress.
+ *
+ * Removes the disconnected objects from the list when the outermost emission ends,
+ * even if a called object throws.
+ */
+class Signal< Args ... >::EmissionGuard
+{
+public:
+    explicit EmissionGuard( const Signal & aSignal ) noexcept;
+    ~EmissionGuard();
+
+    EmissionGuard( const EmissionGuard & ) = delete;
+    EmissionGuard & operator =( const EmissionGuard & ) = delete;
+
+private:
+    const Signal & mySignal;
 };
 
 
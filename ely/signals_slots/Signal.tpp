@@ -6,6 +6,8 @@
  * \brief Source file of the Signal class.
 */
 #include <algorithm>
+#include <mutex>
+#include <thread>
 
 
 namespace ely
@@ -21,12 +23,15 @@ namespace signals_slots
 //------------------------------------------//
 
 template < typename ... Args >
+/*!
+ * \brief Destructor
+ *
+ * Disconnects the signal from every connected objects and from every signals calling it.
+ */
 Signal< Args ... >::~Signal()
 {
-    for ( auto called : myCalledObjects )
-    {
-        called->removeCaller( *this );
-    }
+    disconnectCalled();
+    this->disconnectCallers();
 }
 
 
@@ -46,9 +51,18 @@ template < typename ... Args >
  */
 void Signal< Args ... >::operator ()( Args ... args ) const
 {
-    for ( auto called : myCalledObjects )
+    ::std::lock_guard< typename Signal::Mutex > lock( this->myMutex );
+    EmissionGuard emission( *this );
+
+    // Objects connected during the emission are only called by the next ones
+    const auto size = myCalledObjects.size();
+
+    for ( decltype( myCalledObjects.size() ) i = 0; i < size; ++i )
     {
-        (*called)( args ... );
+        if ( auto called = myCalledObjects[ i ] )
+        {
+            (*called)( args ... );
+        }
     }
 }
 
@@ -59,6 +73,40 @@ void Signal< Args ... >::operator ()( Args ... args ) const
 //                                          //
 //------------------------------------------//
 
+template < typename ... Args >
+/*!
+ * \brief Disconnect every objects called by the signal.
+ *
+ * Works as \c AbstractCallableObject::disconnectCallers() : the called object is only
+ * locked with a try so a concurrent emission of the called object can't lead to a deadlock.
+ */
+void Signal< Args ... >::disconnectCalled()
+{
+    for ( ; ; )
+    {
+        ::std::unique_lock< typename Signal::Mutex > lock( this->myMutex );
+
+        if ( myCalledObjects.empty() )
+        {
+            return;
+        }
+
+        AbstractCallableObject< Args ... > & called = *myCalledObjects.back();
+        ::std::unique_lock< typename Signal::Mutex > calledLock( called.myMutex, ::std::try_to_lock );
+
+        if ( calledLock.owns_lock() )
+        {
+            called.removeCaller( *this );
+            myCalledObjects.pop_back();
+        }
+        else
+        {
+            lock.unlock();
+            ::std::this_thread::yield();
+        }
+    }
+}
+
 template < typename ... Args >
 void Signal< Args ... >::addCalled( AbstractCallableObject< Args ... > & called )
 {
@@ -77,7 +125,42 @@ void Signal< Args ... >::removeCalled( AbstractCallableObject< Args ... > & call
     
     if ( myCalledObjects.end() != it )
     {
-        myCalledObjects.erase( it );
+        if ( 0 == myEmissionDepth )
+        {
+            myCalledObjects.erase( it );
+        }
+        else // The emission in progress iterates over the list
+        {
+            *it = nullptr;
+            myHasDisconnectedCalled = true;
+        }
+    }
+}
+
+
+//------------------------------------------//
+//                                          //
+//              EmissionGuard               //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+inline Signal< Args ... >::EmissionGuard::EmissionGuard( const Signal & aSignal ) noexcept
+    : mySignal( aSignal )
+{
+    ++mySignal.myEmissionDepth;
+}
+
+template < typename ... Args >
+Signal< Args ... >::EmissionGuard::~EmissionGuard()
+{
+    if ( 0 == --mySignal.myEmissionDepth && mySignal.myHasDisconnectedCalled )
+    {
+        auto & calledObjects = mySignal.myCalledObjects;
+
+        calledObjects.erase( ::std::remove( calledObjects.begin(), calledObjects.end(), nullptr ),
+                             calledObjects.end() );
+        mySignal.myHasDisconnectedCalled = false;
     }
 }
 
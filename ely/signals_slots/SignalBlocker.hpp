@@ -0,0 +1,67 @@
+/*!
+ * \file SignalBlocker.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the SignalBlocker class.
+ */
+#ifndef SIGNAL_BLOCKER_HPP
+#define SIGNAL_BLOCKER_HPP
+
+
+#include "ely/signals_slots/BlockableSignal.hpp"
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+template < typename ... Args >
+/*!
+ * \brief The SignalBlocker class
+ *
+ * Blocks a signal, or only one of its connections, for the lifetime of the blocker.\n
+ * Muting a slot this way is cheaper than disconnecting and reconnecting it, and
+ * the connection keeps its position in the calling order.
+ *
+ * Example of use :
+ * \code
+ * {
+ *     SignalBlocker< int > blocker( valueChanged, view.refresh );
+ *
+ *     valueChanged( 42 ); // view.refresh is not called
+ * }
+ *
+ * valueChanged( 43 ); // view.refresh is called
+ * \endcode
+ *
+ * \sa BlockableSignal::block()
+ * \sa block( BlockableSignal< Args ... > &, AbstractCallableObject< Args ... > & )
+ */
+class SignalBlocker final
+{
+public:
+    explicit SignalBlocker( BlockableSignal< Args ... > & aSignal );
+    SignalBlocker( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject );
+    ~SignalBlocker();
+
+    SignalBlocker( const SignalBlocker & ) = delete;
+    SignalBlocker & operator =( const SignalBlocker & ) = delete;
+
+private:
+    BlockableSignal< Args ... > & mySignal;
+    /// The blocked connected object, \c nullptr when the whole signal is blocked.
+    AbstractCallableObject< Args ... > * myCallableObject;
+};
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#include "ely/signals_slots/SignalBlocker.tpp"
+
+
+#endif // SIGNAL_BLOCKER_HPP
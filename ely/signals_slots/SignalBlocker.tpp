@@ -0,0 +1,73 @@
+/*!
+ * \file SignalBlocker.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the SignalBlocker class.
+*/
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Constructor
+ *
+ * Blocks the whole signal \p aSignal .
+ *
+ * \param aSignal The signal to block.
+ */
+SignalBlocker< Args ... >::SignalBlocker( BlockableSignal< Args ... > & aSignal )
+    : mySignal( aSignal ),
+    myCallableObject( nullptr )
+{
+    mySignal.block();
+}
+
+template < typename ... Args >
+/*!
+ * \brief Constructor
+ *
+ * Blocks only the connection between \p aSignal and \p callableObject .
+ *
+ * \param aSignal           The signal calling \p callableObject .
+ * \param callableObject    The object to not call.
+ */
+SignalBlocker< Args ... >::SignalBlocker( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
+    : mySignal( aSignal ),
+    myCallableObject( &callableObject )
+{
+    block( mySignal, *myCallableObject );
+}
+
+template < typename ... Args >
+/*!
+ * \brief Destructor
+ *
+ * Unblocks what was blocked by the constructor.
+ */
+SignalBlocker< Args ... >::~SignalBlocker()
+{
+    if ( nullptr == myCallableObject )
+    {
+        mySignal.unblock();
+    }
+    else
+    {
+        unblock( mySignal, *myCallableObject );
+    }
+}
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
@@ -0,0 +1,181 @@
+/*!
+ * \file SignalRecorder.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the SignalRecorder class.
+ */
+#ifndef SIGNAL_RECORDER_HPP
+#define SIGNAL_RECORDER_HPP
+
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+
+#include "ely/signals_slots/AbstractCallableObject.hpp"
+#include "ely/signals_slots/Serializer.hpp"
+#include "ely/signals_slots/Signal.hpp"
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+namespace detail
+{
+
+
+/*!
+ * \brief The format of a record.
+ *
+ * A record starts with a header : the magic characters \e ELYR, the version
+ * of the format, the number of arguments of the signal and the tag of each argument.\n
+ * Then each emission is written as the time elapsed since the previous one,
+ * in nanoseconds with a variable length, followed by the serialized arguments.
+ */
+struct RecordFormat
+{
+    /// The type of the clock used to time the emissions.
+    typedef ::std::chrono::steady_clock Clock;
+
+
+    static constexpr const char * magic() noexcept
+    {
+        return "ELYR";
+    }
+
+    static constexpr ::std::size_t magicSize() noexcept
+    {
+        return 4;
+    }
+
+    static constexpr char version() noexcept
+    {
+        return 2;
+    }
+
+
+    template < typename T >
+    static void writeTag( ::std::ostream & os );
+    template < typename T >
+    static bool readTag( ::std::istream & is );
+
+private:
+    template < typename T >
+    static constexpr char kind() noexcept;
+    template < typename T >
+    static constexpr ::std::uint64_t size() noexcept;
+};
+
+
+template < typename T >
+/*!
+ * \brief Write the tag of an argument type.
+ *
+ * The tag is the kind of the type followed by its size, so a record can't be replayed
+ * with other arguments of the same number.
+ *
+ * \param os The stream to write in.
+ */
+inline void RecordFormat::writeTag( ::std::ostream & os )
+{
+    os.put( kind< T >() );
+    writeVarint( os, size< T >() );
+}
+
+template < typename T >
+/*!
+ * \brief Read the tag of an argument type written by \c writeTag() .
+ *
+ * \param is The stream to read from.
+ *
+ * \return \c true if the tag matches the type \c T , \c false otherwise or on error.
+ */
+inline bool RecordFormat::readTag( ::std::istream & is )
+{
+    ::std::uint64_t tagSize = 0;
+    const auto tagKind = is.get();
+
+    return readVarint( is, tagSize ) && kind< T >() == tagKind && size< T >() == tagSize;
+}
+
+template < typename T >
+/// The kind of an argument type : \e b for bool, \e i and \e u for the integers, \e f for the floating points, \e e for the enumerations, \e s for the strings and \e o for the others.
+constexpr char RecordFormat::kind() noexcept
+{
+    return ::std::is_same< T, bool >::value ? 'b' :
+           ::std::is_enum< T >::value ? 'e' :
+           ::std::is_floating_point< T >::value ? 'f' :
+           ::std::is_signed< T >::value ? 'i' :
+           ::std::is_unsigned< T >::value ? 'u' :
+           ::std::is_same< T, ::std::string >::value ? 's' :
+           'o';
+}
+
+template < typename T >
+/// The size of an argument type, \c 0 for the strings whose size depends on the implementation.
+constexpr ::std::uint64_t RecordFormat::size() noexcept
+{
+    return ::std::is_same< T, ::std::string >::value ? 0 : sizeof( T );
+}
+
+
+} // namespace ::ely::signals_slots::detail
+
+
+template < typename ... Args >
+/*!
+ * \brief The SignalRecorder class
+ *
+ * Records every emissions of the signals it is connected to in a compact binary stream.\n
+ * The arguments are written with \c Serializer , so their types must be serializable.\n
+ * The record can be replayed with a \c SignalReplayer of the same template parameters.
+ *
+ * Example of use :
+ * \code
+ * ::std::ofstream log( "messages.rec", ::std::ios_base::binary );
+ * SignalRecorder< const ::std::string & > recorder( server.newMessage, log );
+ * \endcode
+ *
+ * \sa SignalReplayer
+ */
+class SignalRecorder final : public AbstractCallableObject< Args ... >
+{
+public:
+    explicit SignalRecorder( ::std::ostream & os );
+    SignalRecorder( Signal< Args ... > & aSignal, ::std::ostream & os );
+    ~SignalRecorder();
+
+
+    void operator ()( Args ... args ) const override;
+
+
+    ::std::size_t getCount() const;
+
+private:
+    typedef detail::RecordFormat::Clock Clock;
+
+
+    ::std::ostream & myStream;
+    mutable ::std::mutex myStreamMutex;
+    mutable Clock::time_point myLastEmission;
+    mutable ::std::size_t myCount;
+};
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#include "ely/signals_slots/SignalRecorder.tpp"
+
+
+#endif // SIGNAL_RECORDER_HPP
@@ -0,0 +1,120 @@
+/*!
+ * \file SignalRecorder.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the SignalRecorder class.
+*/
+#include <type_traits>
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Constructor
+ *
+ * Writes the header of the record in \p os .\n
+ * The recorder must be connected to the signals to record.
+ *
+ * \param os The binary stream to write the record in.
+ */
+SignalRecorder< Args ... >::SignalRecorder( ::std::ostream & os )
+    : myStream( os ),
+    myLastEmission( Clock::now() ),
+    myCount( 0 )
+{
+    myStream.write( detail::RecordFormat::magic(), detail::RecordFormat::magicSize() );
+    myStream.put( detail::RecordFormat::version() );
+    myStream.put( static_cast< char >( sizeof ... ( Args ) ) );
+
+    int expand[] = { 0, ( detail::RecordFormat::writeTag< typename ::std::decay< Args >::type >( myStream ), 0 ) ... };
+    static_cast< void >( expand );
+}
+
+template < typename ... Args >
+/*!
+ * \brief Constructor
+ *
+ * Writes the header of the record in \p os and starts to record \p aSignal .
+ *
+ * \param aSignal   The signal to record.
+ * \param os        The binary stream to write the record in.
+ */
+SignalRecorder< Args ... >::SignalRecorder( Signal< Args ... > & aSignal, ::std::ostream & os )
+    : SignalRecorder( os )
+{
+    connect( aSignal, *this );
+}
+
+template < typename ... Args >
+/*!
+ * \brief Destructor
+ *
+ * Stops recording and flushes the stream.
+ */
+SignalRecorder< Args ... >::~SignalRecorder()
+{
+    this->disconnectCallers();
+
+    myStream.flush();
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief operator ()
+ *
+ * Writes the time elapsed since the previous emission and the arguments of the emission.
+ *
+ * \param args The arguments of the emission.
+ */
+void SignalRecorder< Args ... >::operator ()( Args ... args ) const
+{
+    ::std::lock_guard< ::std::mutex > lock( myStreamMutex );
+
+    const Clock::time_point now = Clock::now();
+    const auto elapsed = ::std::chrono::duration_cast< ::std::chrono::nanoseconds >( now - myLastEmission );
+
+    detail::writeVarint( myStream, static_cast< ::std::uint64_t >( elapsed.count() ) );
+
+    // A braced list guarantees the arguments are written in order
+    int expand[] = { 0, ( Serializer< typename ::std::decay< Args >::type >::write( myStream, args ), 0 ) ... };
+    static_cast< void >( expand );
+
+    myLastEmission = now;
+    ++myCount;
+}
+
+template < typename ... Args >
+/*!
+ * \brief Accessor
+ *
+ * \return The number of emissions recorded.
+ */
+::std::size_t SignalRecorder< Args ... >::getCount() const
+{
+    ::std::lock_guard< ::std::mutex > lock( myStreamMutex );
+
+    return myCount;
+}
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
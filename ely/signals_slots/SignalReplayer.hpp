@@ -0,0 +1,113 @@
+/*!
+ * \file SignalReplayer.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the SignalReplayer class.
+ */
+#ifndef SIGNAL_REPLAYER_HPP
+#define SIGNAL_REPLAYER_HPP
+
+
+#include <cstddef>
+#include <istream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+#include "ely/signals_slots/Signal.hpp"
+#include "ely/signals_slots/SignalRecorder.hpp"
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+template < typename ... Args >
+/*!
+ * \brief The SignalReplayer class
+ *
+ * Emits again a signal with the emissions recorded by a \c SignalRecorder
+ * of the same template parameters.\n
+ * The emissions can be replayed with their recorded timing, to reproduce a flow of messages,
+ * or at the maximum speed, to measure the throughput of the connected slots.
+ *
+ * Example of use :
+ * \code
+ * ::std::ifstream log( "messages.rec", ::std::ios_base::binary );
+ * SignalReplayer< const ::std::string & > replayer( log );
+ *
+ * replayer.replay( client.newMessage, SignalReplayer< const ::std::string & >::Speed::Maximum );
+ * \endcode
+ *
+ * \sa SignalRecorder
+ */
+class SignalReplayer final
+{
+public:
+    /// The pace of the replay.
+    enum class Speed
+    {
+        Recorded,   ///< Waits between the emissions as long as recorded.
+        Maximum     ///< Emits as fast as possible.
+    };
+
+
+    explicit SignalReplayer( ::std::istream & is );
+
+    SignalReplayer( const SignalReplayer & ) = delete;
+    SignalReplayer & operator =( const SignalReplayer & ) = delete;
+
+
+    bool isValid() const noexcept;
+
+
+    bool replayNext( Signal< Args ... > & aSignal, Speed speed = Speed::Recorded );
+    ::std::size_t replay( Signal< Args ... > & aSignal, Speed speed = Speed::Recorded );
+
+private:
+    typedef detail::RecordFormat::Clock Clock;
+    /// The arguments of an emission.
+    typedef ::std::tuple< typename ::std::decay< Args >::type ... > Arguments;
+
+
+    template < ::std::size_t ... Indices >
+    void read( Arguments & arguments, ::std::index_sequence< Indices ... > );
+    template < ::std::size_t ... Indices >
+    void emit( Signal< Args ... > & aSignal, Arguments & arguments, ::std::index_sequence< Indices ... > );
+
+
+    ::std::istream & myStream;
+    bool myIsValid;
+    bool myIsStarted;
+    /// The moment the replay started.
+    Clock::time_point myStart;
+    /// The recorded time elapsed between the start of the record and the last emission read.
+    Clock::duration myElapsed;
+};
+
+
+template < typename ... Args >
+/*!
+ * \brief Check if the record is valid.
+ *
+ * \return \c false if the header of the record doesn't match the template parameters
+ * or if a read failed, \c true otherwise.
+ */
+inline bool SignalReplayer< Args ... >::isValid() const noexcept
+{
+    return myIsValid;
+}
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
+
+
+#include "ely/signals_slots/SignalReplayer.tpp"
+
+
+#endif // SIGNAL_REPLAYER_HPP
@@ -0,0 +1,175 @@
+/*!
+ * \file SignalReplayer.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the SignalReplayer class.
+*/
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+
+namespace ely
+{
+namespace signals_slots
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Constructor
+ *
+ * Reads and checks the header of the record.
+ *
+ * \param is The binary stream containing the record.
+ *
+ * \sa isValid()
+ */
+SignalReplayer< Args ... >::SignalReplayer( ::std::istream & is )
+    : myStream( is ),
+    myIsValid( false ),
+    myIsStarted( false ),
+    myStart(),
+    myElapsed( Clock::duration::zero() )
+{
+    char magic[ detail::RecordFormat::magicSize() ];
+
+    if ( myStream.read( magic, sizeof( magic ) ) )
+    {
+        const auto version = myStream.get();
+        const auto arity = myStream.get();
+
+        myIsValid = myStream &&
+                    ::std::equal( magic, magic + sizeof( magic ), detail::RecordFormat::magic() ) &&
+                    detail::RecordFormat::version() == version &&
+                    static_cast< int >( sizeof ... ( Args ) ) == arity;
+
+        // A braced list guarantees the tags are read in order
+        bool expand[] = { true, ( myIsValid = myIsValid && detail::RecordFormat::readTag< typename ::std::decay< Args >::type >( myStream ) ) ... };
+        static_cast< void >( expand );
+    }
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Replay the next emission of the record.
+ *
+ * With the speed \c Speed::Recorded , waits until the emission is due :
+ * the delays are measured from the first emission replayed.
+ *
+ * \param aSignal   The signal to emit.
+ * \param speed     The pace of the replay.
+ *
+ * \return \c true if an emission was replayed, \c false at the end of the record or on error.
+ *
+ * \sa isValid()
+ */
+bool SignalReplayer< Args ... >::replayNext( Signal< Args ... > & aSignal, Speed speed )
+{
+    if ( ! myIsValid || ::std::istream::traits_type::eof() == myStream.peek() )
+    {
+        return false;
+    }
+
+    ::std::uint64_t delay = 0;
+    Arguments arguments;
+
+    if ( ! detail::readVarint( myStream, delay ) )
+    {
+        myIsValid = false;
+
+        return false;
+    }
+
+    read( arguments, ::std::index_sequence_for< Args ... >{} );
+
+    if ( ! myStream )
+    {
+        myIsValid = false;
+
+        return false;
+    }
+
+    if ( ! myIsStarted )
+    {
+        myStart = Clock::now();
+        myIsStarted = true;
+    }
+    else
+    {
+        myElapsed += ::std::chrono::duration_cast< Clock::duration >( ::std::chrono::nanoseconds( delay ) );
+    }
+
+    if ( Speed::Recorded == speed )
+    {
+        ::std::this_thread::sleep_until( myStart + myElapsed );
+    }
+
+    emit( aSignal, arguments, ::std::index_sequence_for< Args ... >{} );
+
+    return true;
+}
+
+template < typename ... Args >
+/*!
+ * \brief Replay every remaining emissions of the record.
+ *
+ * \param aSignal   The signal to emit.
+ * \param speed     The pace of the replay.
+ *
+ * \return The number of emissions replayed.
+ *
+ * \sa replayNext()
+ */
+::std::size_t SignalReplayer< Args ... >::replay( Signal< Args ... > & aSignal, Speed speed )
+{
+    ::std::size_t count = 0;
+
+    while ( replayNext( aSignal, speed ) )
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Private functions            //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+template < ::std::size_t ... Indices >
+void SignalReplayer< Args ... >::read( Arguments & arguments, ::std::index_sequence< Indices ... > )
+{
+    // A braced list guarantees the arguments are read in order
+    int expand[] = { 0, ( Serializer< typename ::std::decay< Args >::type >::read( myStream, ::std::get< Indices >( arguments ) ), 0 ) ... };
+    static_cast< void >( expand );
+}
+
+template < typename ... Args >
+template < ::std::size_t ... Indices >
+void SignalReplayer< Args ... >::emit( Signal< Args ... > & aSignal, Arguments & arguments, ::std::index_sequence< Indices ... > )
+{
+    aSignal( ::std::get< Indices >( arguments ) ... );
+}
+
+
+} // namespace ::ely::signals_slots
+} // namespace ::ely
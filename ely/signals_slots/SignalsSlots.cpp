@@ -0,0 +1,17 @@
+/*!
+ * \file SignalsSlots.cpp
+ *
+ * \author Ely
+ *
+ * \brief Compiles the signals/slots of the common signatures once for every users of the library.
+ *
+ * \sa SignalsSlots.hpp
+ * \sa instantiation.hpp
+ */
+#include "ely/signals_slots/SignalsSlots.hpp"
+
+
+ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE()
+ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( bool )
+ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( int )
+ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( const ::std::string & )
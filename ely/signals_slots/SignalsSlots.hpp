@@ -2,9 +2,15 @@
 #define SIGNALS_SLOTS_HPP
 
 
+#include <string>
+
+
+#include "ely/signals_slots/BlockableSignal.hpp"
 #include "ely/signals_slots/Signal.hpp"
+#include "ely/signals_slots/SignalBlocker.hpp"
 #include "ely/signals_slots/Slot.hpp"
 #include "ely/signals_slots/connect.hpp"
+#include "ely/signals_slots/instantiation.hpp"
 
 namespace ely
 {
@@ -12,9 +18,23 @@ namespace ely
 
 using signals_slots::connect;
 using signals_slots::disconnect;
+using signals_slots::block;
+using signals_slots::unblock;
+using signals_slots::isBlocked;
 
 
 } // namespace ::ely
 
 
+// The common signatures are compiled once in the library, see SignalsSlots.cpp
+#if ! defined ( ELY_SIGNALS_SLOTS_NO_EXTERN_TEMPLATES )
+
+ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE()
+ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( bool )
+ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( int )
+ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( const ::std::string & )
+
+#endif // ELY_SIGNALS_SLOTS_NO_EXTERN_TEMPLATES
+
+
 #endif // SIGNALSSLOTS
@@ -29,11 +29,17 @@ template < typename ... Args >
  * A slot is a template object defined by its template parameters.\n
  * It can be connected to any signal with the same template parameters.\n
  * Each time a signal connected to a slot is emit, the function bound to
- * the corresponding slot is called.
+ * the corresponding slot is called.\n\n
+ *
+ * Binding a function is not thread-safe : bind the slot before connecting it.
  */
 class Slot final : public AbstractCallableObject< Args ... >
 {
 public:
+    Slot() = default;
+    ~Slot();
+
+
     template < class Object, typename ... FArgs >
     void bind( void ( Object::* slotFunction )( FArgs ... ), Object & object );
     void bind( ::std::function< void( Args ... ) > slotFunction );
@@ -13,6 +13,24 @@ namespace signals_slots
 {
 
 
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename ... Args >
+/*!
+ * \brief Destructor
+ *
+ * Disconnects the slot before its bound function is destroyed.
+ */
+Slot< Args ... >::~Slot()
+{
+    this->disconnectCallers();
+}
+
+
 //------------------------------------------//
 //                                          //
 //             Public functions             //
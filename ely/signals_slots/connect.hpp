@@ -8,15 +8,25 @@ namespace signals_slots
 {
 
 
-template < typename ... Args > class Signal;
+template < typename ... Args > class AbstractSignal;
+template < typename ... Args > class BlockableSignal;
 template < typename ... Args > class AbstractCallableObject;
 
 
-template < typename ... SignalArgs, typename ... CallableArgs >
-void connect( Signal< SignalArgs ... > & aSignal, AbstractCallableObject< CallableArgs ... > & callableObject );
+template < typename ... Args >
+void connect( AbstractSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject );
 
-template < typename ... SignalArgs, typename ... CallableArgs >
-void disconnect( Signal< SignalArgs ... > & aSignal, AbstractCallableObject< CallableArgs ... > & callableObject );
+template < typename ... Args >
+void disconnect( AbstractSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject );
+
+template < typename ... Args >
+void block( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject );
+
+template < typename ... Args >
+void unblock( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject );
+
+template < typename ... Args >
+bool isBlocked( const BlockableSignal< Args ... > & aSignal, const AbstractCallableObject< Args ... > & callableObject );
 
 
 } // namespace ::ely::signals_slots
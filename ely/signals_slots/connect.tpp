@@ -1,3 +1,6 @@
+#include <mutex>
+
+
 namespace ely
 {
 namespace signals_slots
@@ -5,19 +8,113 @@ namespace signals_slots
 
 
 template < typename ... Args >
-void connect( Signal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
+/*!
+ * \brief Connect a callable object to a signal.
+ *
+ * Does nothing if \p callableObject is already connected to \p aSignal.\n
+ * Waits for the emissions of \p aSignal in progress in other threads.
+ *
+ * \param aSignal          The signal to connect.
+ * \param callableObject   The object to call when \p aSignal is emitted.
+ */
+void connect( AbstractSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
 {
+    ::std::lock( aSignal.myMutex, callableObject.myMutex );
+    ::std::lock_guard< typename AbstractSignal< Args ... >::Mutex > signalLock( aSignal.myMutex, ::std::adopt_lock );
+    ::std::lock_guard< typename AbstractSignal< Args ... >::Mutex > callableLock( callableObject.myMutex, ::std::adopt_lock );
+
     aSignal.addCalled( callableObject );
     callableObject.addCaller( aSignal );
 }
 
 template < typename ... Args >
-void disconnect( Signal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
+/*!
+ * \brief Disconnect a callable object from a signal.
+ *
+ * Waits for the emissions of \p aSignal in progress in other threads, so once
+ * the function returns \p callableObject is not called by \p aSignal anymore.
+ *
+ * \param aSignal          The signal to disconnect.
+ * \param callableObject   The object to not call anymore.
+ */
+void disconnect( AbstractSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
 {
+    ::std::lock( aSignal.myMutex, callableObject.myMutex );
+    ::std::lock_guard< typename AbstractSignal< Args ... >::Mutex > signalLock( aSignal.myMutex, ::std::adopt_lock );
+    ::std::lock_guard< typename AbstractSignal< Args ... >::Mutex > callableLock( callableObject.myMutex, ::std::adopt_lock );
+
     aSignal.removeCalled( callableObject );
     callableObject.removeCaller( aSignal );
 }
 
+template < typename ... Args >
+/*!
+ * \brief Block the connection between a signal and a callable object.
+ *
+ * While the connection is blocked, \p callableObject is not called when \p aSignal is emitted
+ * but it stays connected.\n
+ * The blocks are counted : the connection must be unblocked as many times as it was blocked.\n
+ * Does nothing if \p callableObject is not connected to \p aSignal .
+ *
+ * \param aSignal          The signal calling \p callableObject .
+ * \param callableObject   The object to not call anymore.
+ *
+ * \sa unblock()
+ * \sa SignalBlocker
+ */
+void block( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
+{
+    ::std::lock_guard< typename BlockableSignal< Args ... >::Mutex > lock( aSignal.myMutex );
+
+    auto it = aSignal.findCalled( callableObject );
+
+    if ( aSignal.myCalledObjects.end() != it )
+    {
+        ++it->blockCount;
+    }
+}
+
+template < typename ... Args >
+/*!
+ * \brief Unblock the connection between a signal and a callable object.
+ *
+ * Cancels one call of \c block() , does nothing if the connection is not blocked.
+ *
+ * \param aSignal          The signal calling \p callableObject .
+ * \param callableObject   The object to call again.
+ *
+ * \sa block()
+ */
+void unblock( BlockableSignal< Args ... > & aSignal, AbstractCallableObject< Args ... > & callableObject )
+{
+    ::std::lock_guard< typename BlockableSignal< Args ... >::Mutex > lock( aSignal.myMutex );
+
+    auto it = aSignal.findCalled( callableObject );
+
+    if ( aSignal.myCalledObjects.end() != it && 0 != it->blockCount )
+    {
+        --it->blockCount;
+    }
+}
+
+template < typename ... Args >
+/*!
+ * \brief Check if the connection between a signal and a callable object is blocked.
+ *
+ * \param aSignal          The signal calling \p callableObject .
+ * \param callableObject   The connected object.
+ *
+ * \return \c true if the connection is blocked, \c false otherwise or if there is no connection.
+ */
+bool isBlocked( const BlockableSignal< Args ... > & aSignal, const AbstractCallableObject< Args ... > & callableObject )
+{
+    ::std::lock_guard< typename BlockableSignal< Args ... >::Mutex > lock( aSignal.myMutex );
+
+    auto it = aSignal.findCalled( callableObject );
+
+    return aSignal.myCalledObjects.end() != it && 0 != it->blockCount;
+}
+
 
 } // namespace ::ely::signals_slots
 } // namespace ::ely
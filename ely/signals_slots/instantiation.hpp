@@ -0,0 +1,60 @@
+/*!
+ * \file instantiation.hpp
+ *
+ * \author Ely
+ *
+ * \brief Macros to compile the signals/slots of a signature only once.
+ *
+ * Every translation unit using a \c Signal or a \c Slot instantiates the whole
+ * signals/slots system for its signature.\n
+ * To compile a signature only once, declare it in a header :
+ * \code
+ * ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( const Message & )
+ * \endcode
+ * and instantiate it in one source file :
+ * \code
+ * ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( const Message & )
+ * \endcode
+ *
+ * The common signatures are already compiled in the library, see SignalsSlots.hpp .
+ */
+#ifndef INSTANTIATION_HPP
+#define INSTANTIATION_HPP
+
+
+#include "ely/signals_slots/AbstractCallableObject.hpp"
+#include "ely/signals_slots/AbstractSignal.hpp"
+#include "ely/signals_slots/BlockableSignal.hpp"
+#include "ely/signals_slots/Signal.hpp"
+#include "ely/signals_slots/SignalBlocker.hpp"
+#include "ely/signals_slots/Slot.hpp"
+#include "ely/signals_slots/connect.hpp"
+
+
+/// Applies the keywords \p prefix to every templates of the signals/slots system for the signature \p ... .
+#define ELY_SIGNALS_SLOTS_TEMPLATE( prefix, ... ) \
+    prefix class ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ >; \
+    prefix class ::ely::signals_slots::AbstractSignal< __VA_ARGS__ >; \
+    prefix class ::ely::signals_slots::Signal< __VA_ARGS__ >; \
+    prefix class ::ely::signals_slots::BlockableSignal< __VA_ARGS__ >; \
+    prefix class ::ely::signals_slots::Slot< __VA_ARGS__ >; \
+    prefix void ::ely::signals_slots::connect< __VA_ARGS__ >( ::ely::signals_slots::AbstractSignal< __VA_ARGS__ > &, \
+                                                              ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ > & ); \
+    prefix void ::ely::signals_slots::disconnect< __VA_ARGS__ >( ::ely::signals_slots::AbstractSignal< __VA_ARGS__ > &, \
+                                                                 ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ > & ); \
+    prefix void ::ely::signals_slots::block< __VA_ARGS__ >( ::ely::signals_slots::BlockableSignal< __VA_ARGS__ > &, \
+                                                            ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ > & ); \
+    prefix void ::ely::signals_slots::unblock< __VA_ARGS__ >( ::ely::signals_slots::BlockableSignal< __VA_ARGS__ > &, \
+                                                              ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ > & ); \
+    prefix bool ::ely::signals_slots::isBlocked< __VA_ARGS__ >( const ::ely::signals_slots::BlockableSignal< __VA_ARGS__ > &, \
+                                                                const ::ely::signals_slots::AbstractCallableObject< __VA_ARGS__ > & ); \
+    prefix class ::ely::signals_slots::SignalBlocker< __VA_ARGS__ >;
+
+/// Declares the signals/slots of the signature \p ... as instantiated in another translation unit.
+#define ELY_SIGNALS_SLOTS_EXTERN_TEMPLATE( ... )        ELY_SIGNALS_SLOTS_TEMPLATE( extern template, __VA_ARGS__ )
+
+/// Instantiates the signals/slots of the signature \p ... , must be used in only one translation unit.
+#define ELY_SIGNALS_SLOTS_INSTANTIATE_TEMPLATE( ... )   ELY_SIGNALS_SLOTS_TEMPLATE( template, __VA_ARGS__ )
+
+
+#endif // INSTANTIATION_HPP
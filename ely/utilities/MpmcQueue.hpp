@@ -0,0 +1,164 @@
+/*!
+ * \file MpmcQueue.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the MpmcQueue class.
+ */
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+#include "ely/config.hpp"
+#include "ely/utilities/SpscQueue.hpp"
+
+
+namespace ely
+{
+namespace utilities
+{
+
+
+template < typename T >
+/*!
+ * \brief The MpmcQueue class
+ *
+ * A bounded lock-free queue for any number of producer and consumer threads.\n\n
+ *
+ * The elements are stored in a ring buffer whose capacity is a power of two.\n
+ * Each cell of the ring buffer holds a sequence number telling if it is ready to be
+ * written or read for a given round, so producers and consumers only compete on the
+ * index of their own side, each one on its own cache line.\n
+ * The batch functions reserve all their cells with a single atomic operation.\n\n
+ *
+ * A reserved cell must always be filled, otherwise the consumers would wait for it
+ * forever : an element whose constructor can throw is built before reserving its cell,
+ * so its type must be nothrow move constructible.
+ *
+ * \sa SpscQueue
+ */
+class MpmcQueue final
+{
+public:
+    /// The type of the elements.
+    typedef T ValueType;
+    /// The type of the sizes.
+    typedef ::std::size_t SizeType;
+
+
+    explicit MpmcQueue( SizeType capacity );
+    ~MpmcQueue();
+
+    MpmcQueue( const MpmcQueue & ) = delete;
+    MpmcQueue & operator =( const MpmcQueue & ) = delete;
+
+
+    SizeType getCapacity() const noexcept;
+    SizeType getSize() const noexcept;
+    bool isEmpty() const noexcept;
+
+
+    template < typename ... ConstructorArgs >
+    bool tryEmplace( ConstructorArgs && ... constructorArgs );
+    bool tryPush( const T & value );
+    bool tryPush( T && value );
+    template < typename ForwardIterator >
+    SizeType tryPushBatch( ForwardIterator first, ForwardIterator last );
+
+    bool tryPop( T & value );
+    template < typename OutputIterator >
+    SizeType tryPopBatch( OutputIterator output, SizeType maximum );
+
+private:
+    ELY_ASSERT_MSG( ::std::is_nothrow_move_constructible< T >::value,
+                    "The elements of a MpmcQueue must be nothrow move constructible" );
+
+    /// A cell of the ring buffer.
+    struct Cell
+    {
+        /// Equals the index of the cell when it can be written, the index plus one when it can be read.
+        ::std::atomic< SizeType > sequence;
+        typename ::std::aligned_storage< sizeof( T ), alignof( T ) >::type storage;
+
+        T & element() noexcept
+        {
+            return *reinterpret_cast< T * >( &storage );
+        }
+    };
+
+
+    SizeType reserve( ::std::atomic< SizeType > & position, SizeType ready, SizeType maximum, SizeType & first );
+    Cell & cellAt( SizeType index ) noexcept;
+    template < typename ... ConstructorArgs >
+    void construct( SizeType index, ::std::true_type, ConstructorArgs && ... constructorArgs );
+    template < typename ... ConstructorArgs >
+    void construct( SizeType index, ::std::false_type, ConstructorArgs && ... constructorArgs );
+    void release( SizeType index ) noexcept;
+
+
+    const SizeType myMask;
+    const ::std::unique_ptr< Cell[] > myCells;
+
+    /// The index of the next cell to write, shared by the producers.
+    alignas( ELY_CACHE_LINE_SIZE ) ::std::atomic< SizeType > myEnqueuePosition;
+    /// The index of the next cell to read, shared by the consumers.
+    alignas( ELY_CACHE_LINE_SIZE ) ::std::atomic< SizeType > myDequeuePosition;
+};
+
+
+template < typename T >
+/*!
+ * \brief Accessor
+ *
+ * \return The maximum number of elements in the queue.
+ */
+inline typename MpmcQueue< T >::SizeType MpmcQueue< T >::getCapacity() const noexcept
+{
+    return myMask + 1;
+}
+
+template < typename T >
+/*!
+ * \brief Accessor
+ *
+ * The value can be outdated as soon as it is returned, it includes the elements
+ * being pushed and excludes the elements being popped.
+ *
+ * \return The number of elements in the queue.
+ */
+inline typename MpmcQueue< T >::SizeType MpmcQueue< T >::getSize() const noexcept
+{
+    const SizeType dequeuePosition = myDequeuePosition.load( ::std::memory_order_acquire );
+    const SizeType enqueuePosition = myEnqueuePosition.load( ::std::memory_order_acquire );
+
+    return ( enqueuePosition > dequeuePosition ) ? enqueuePosition - dequeuePosition : 0;
+}
+
+template < typename T >
+/*!
+ * \brief Check if the queue is empty.
+ *
+ * \return \c true if there is no element in the queue, \c false otherwise.
+ *
+ * \sa getSize()
+ */
+inline bool MpmcQueue< T >::isEmpty() const noexcept
+{
+    return 0 == getSize();
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
+
+
+#include "ely/utilities/MpmcQueue.tpp"
+
+
+#endif // MPMC_QUEUE_HPP
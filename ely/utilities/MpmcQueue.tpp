@@ -0,0 +1,360 @@
+/*!
+ * \file MpmcQueue.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the MpmcQueue class.
+*/
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+
+namespace ely
+{
+namespace utilities
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+/*!
+ * \brief Constructor
+ *
+ * \param capacity The maximum number of elements, rounded up to a power of two.
+ */
+MpmcQueue< T >::MpmcQueue( SizeType capacity )
+    : myMask( detail::roundCapacity( capacity ) - 1 ),
+    myCells( new Cell[ myMask + 1 ] ),
+    myEnqueuePosition( 0 ),
+    myDequeuePosition( 0 )
+{
+    for ( SizeType i = 0; i <= myMask; ++i )
+    {
+        myCells[ i ].sequence.store( i, ::std::memory_order_relaxed );
+    }
+}
+
+template < typename T >
+/*!
+ * \brief Destructor
+ *
+ * Destroys the elements remaining in the queue.
+ */
+MpmcQueue< T >::~MpmcQueue()
+{
+    const SizeType enqueuePosition = myEnqueuePosition.load( ::std::memory_order_acquire );
+
+    for ( SizeType i = myDequeuePosition.load( ::std::memory_order_relaxed ); i != enqueuePosition; ++i )
+    {
+        myCells[ i & myMask ].element().~T();
+    }
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+template < typename ... ConstructorArgs >
+/*!
+ * \brief Construct an element at the end of the queue.
+ *
+ * \param constructorArgs The arguments to forward to the constructor of the element.
+ *
+ * \return \c true if the element was pushed, \c false if the queue is full.
+ */
+bool MpmcQueue< T >::tryEmplace( ConstructorArgs && ... constructorArgs )
+{
+    typedef ::std::is_nothrow_constructible< T, ConstructorArgs && ... > IsNothrow;
+
+    if ( IsNothrow::value )
+    {
+        SizeType index = 0;
+
+        if ( 0 == reserve( myEnqueuePosition, 0, 1, index ) )
+        {
+            return false;
+        }
+
+        construct( index, IsNothrow(), ::std::forward< ConstructorArgs >( constructorArgs ) ... );
+    }
+    else
+    {
+        // Build the element first : a reserved cell must always be filled
+        T element( ::std::forward< ConstructorArgs >( constructorArgs ) ... );
+        SizeType index = 0;
+
+        if ( 0 == reserve( myEnqueuePosition, 0, 1, index ) )
+        {
+            return false;
+        }
+
+        construct( index, ::std::true_type(), ::std::move( element ) );
+    }
+
+    return true;
+}
+
+template < typename T >
+/*!
+ * \brief Push a copy of \p value at the end of the queue.
+ *
+ * \param value The value to push.
+ *
+ * \return \c true if the value was pushed, \c false if the queue is full.
+ *
+ * \sa tryEmplace()
+ */
+bool MpmcQueue< T >::tryPush( const T & value )
+{
+    return tryEmplace( value );
+}
+
+template < typename T >
+/*!
+ * \brief Move \p value at the end of the queue.
+ *
+ * \param value The value to push, left untouched if the queue is full.
+ *
+ * \return \c true if the value was pushed, \c false if the queue is full.
+ *
+ * \sa tryEmplace()
+ */
+bool MpmcQueue< T >::tryPush( T && value )
+{
+    return tryEmplace( ::std::move( value ) );
+}
+
+template < typename T >
+template < typename ForwardIterator >
+/*!
+ * \brief Push as many elements of the range [ \p first, \p last ) as possible.
+ *
+ * The cells of the elements are reserved all at once.\n
+ * The elements must be nothrow constructible from the values of the range.
+ *
+ * \param first The first element to push.
+ * \param last  The end of the range.
+ *
+ * \return The number of elements pushed, from \p first .
+ */
+typename MpmcQueue< T >::SizeType MpmcQueue< T >::tryPushBatch( ForwardIterator first, ForwardIterator last )
+{
+    ELY_ASSERT_MSG( ( ::std::is_nothrow_constructible< T, decltype( *first ) >::value ),
+                    "The elements of a batch must be nothrow constructible from the values of the range" );
+
+    const auto distance = ::std::distance( first, last );
+
+    if ( 0 >= distance )
+    {
+        return 0;
+    }
+
+    SizeType index = 0;
+    const SizeType count = reserve( myEnqueuePosition, 0, static_cast< SizeType >( distance ), index );
+
+    for ( SizeType i = 0; i < count; ++i, ++first )
+    {
+        construct( index + i, ::std::true_type(), *first );
+    }
+
+    return count;
+}
+
+template < typename T >
+/*!
+ * \brief Pop the first element of the queue.
+ *
+ * If moving the element in \p value throws, the element is lost.
+ *
+ * \param value The variable receiving the element.
+ *
+ * \return \c true if an element was popped, \c false if the queue is empty.
+ */
+bool MpmcQueue< T >::tryPop( T & value )
+{
+    SizeType index = 0;
+
+    if ( 0 == reserve( myDequeuePosition, 1, 1, index ) )
+    {
+        return false;
+    }
+
+    try
+    {
+        value = ::std::move( cellAt( index ).element() );
+    }
+    catch ( ... )
+    {
+        release( index );
+
+        throw;
+    }
+
+    release( index );
+
+    return true;
+}
+
+template < typename T >
+template < typename OutputIterator >
+/*!
+ * \brief Pop up to \p maximum elements.
+ *
+ * The cells of the elements are reserved all at once.\n
+ * If writing an element in \p output throws, the remaining reserved elements are lost.
+ *
+ * \param output    The iterator receiving the elements.
+ * \param maximum   The maximum number of elements to pop.
+ *
+ * \return The number of elements popped.
+ */
+typename MpmcQueue< T >::SizeType MpmcQueue< T >::tryPopBatch( OutputIterator output, SizeType maximum )
+{
+    if ( 0 == maximum )
+    {
+        return 0;
+    }
+
+    SizeType index = 0;
+    const SizeType count = reserve( myDequeuePosition, 1, maximum, index );
+    SizeType i = 0;
+
+    try
+    {
+        for ( ; i < count; ++i, ++output )
+        {
+            *output = ::std::move( cellAt( index + i ).element() );
+            release( index + i );
+        }
+    }
+    catch ( ... )
+    {
+        for ( ; i < count; ++i )
+        {
+            release( index + i );
+        }
+
+        throw;
+    }
+
+    return count;
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Private functions            //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+/*!
+ * \brief Reserve consecutive cells.
+ *
+ * Reserves up to \p maximum cells, from \p position , whose sequence number equals
+ * their index plus \p ready and moves \p position after them.
+ *
+ * \param position  The index of the side to move.
+ * \param ready     \c 0 to reserve cells to write, \c 1 to reserve cells to read.
+ * \param maximum   The maximum number of cells to reserve, must not be \c 0 .
+ * \param first     The variable receiving the index of the first reserved cell.
+ *
+ * \return The number of reserved cells, \c 0 if the queue is full or empty.
+ */
+typename MpmcQueue< T >::SizeType MpmcQueue< T >::reserve( ::std::atomic< SizeType > & position,
+                                                           SizeType ready,
+                                                           SizeType maximum,
+                                                           SizeType & first )
+{
+    SizeType current = position.load( ::std::memory_order_relaxed );
+
+    for ( ; ; )
+    {
+        SizeType count = 0;
+        bool isOutdated = false;
+
+        for ( ; count < maximum; ++count )
+        {
+            const SizeType index = current + count;
+            const SizeType sequence = cellAt( index ).sequence.load( ::std::memory_order_acquire );
+            const auto difference = static_cast< ::std::ptrdiff_t >( sequence - ( index + ready ) );
+
+            if ( 0 != difference )
+            {
+                // A cell of the next round : another thread already moved the position
+                isOutdated = ( 0 == count && 0 < difference );
+
+                break;
+            }
+        }
+
+        if ( isOutdated )
+        {
+            current = position.load( ::std::memory_order_relaxed );
+        }
+        else if ( 0 == count )
+        {
+            return 0;
+        }
+        else if ( position.compare_exchange_weak( current, current + count, ::std::memory_order_relaxed ) )
+        {
+            first = current;
+
+            return count;
+        }
+    }
+}
+
+template < typename T >
+inline typename MpmcQueue< T >::Cell & MpmcQueue< T >::cellAt( SizeType index ) noexcept
+{
+    return myCells[ index & myMask ];
+}
+
+template < typename T >
+template < typename ... ConstructorArgs >
+/*!
+ * \brief Construct an element in a reserved cell and publish it to the consumers.
+ */
+void MpmcQueue< T >::construct( SizeType index, ::std::true_type, ConstructorArgs && ... constructorArgs )
+{
+    Cell & cell = cellAt( index );
+
+    new ( &cell.storage ) T( ::std::forward< ConstructorArgs >( constructorArgs ) ... );
+    cell.sequence.store( index + 1, ::std::memory_order_release );
+}
+
+template < typename T >
+template < typename ... ConstructorArgs >
+/*!
+ * \brief Never called, only needed to compile \c tryEmplace() for throwing constructors.
+ */
+void MpmcQueue< T >::construct( SizeType, ::std::false_type, ConstructorArgs && ... )
+{}
+
+template < typename T >
+/*!
+ * \brief Destroy the element of a reserved cell and give the cell back to the producers.
+ */
+void MpmcQueue< T >::release( SizeType index ) noexcept
+{
+    Cell & cell = cellAt( index );
+
+    cell.element().~T();
+    cell.sequence.store( index + myMask + 1, ::std::memory_order_release );
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
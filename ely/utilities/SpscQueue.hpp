@@ -0,0 +1,183 @@
+/*!
+ * \file SpscQueue.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the SpscQueue class.
+ */
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace utilities
+{
+
+
+template < typename T >
+/*!
+ * \brief The SpscQueue class
+ *
+ * A bounded lock-free queue for a single producer thread and a single consumer thread.\n\n
+ *
+ * The elements are stored in a ring buffer whose capacity is a power of two.\n
+ * The producer and the consumer indices live on their own cache lines, with a copy of the
+ * index of the other side, so each side only reads the index of the other one when the
+ * ring buffer looks full or empty.\n
+ * The batch functions publish all their elements with a single atomic store.
+ *
+ * Example of use :
+ * \code
+ * SpscQueue< Message > queue( 1024 );
+ *
+ * // Producer thread
+ * while ( ! queue.tryPush( message ) ) {}
+ *
+ * // Consumer thread
+ * Message received;
+ *
+ * if ( queue.tryPop( received ) ) { ... }
+ * \endcode
+ *
+ * \sa MpmcQueue
+ */
+class SpscQueue final
+{
+public:
+    /// The type of the elements.
+    typedef T ValueType;
+    /// The type of the sizes.
+    typedef ::std::size_t SizeType;
+
+
+    explicit SpscQueue( SizeType capacity );
+    ~SpscQueue();
+
+    SpscQueue( const SpscQueue & ) = delete;
+    SpscQueue & operator =( const SpscQueue & ) = delete;
+
+
+    SizeType getCapacity() const noexcept;
+    SizeType getSize() const noexcept;
+    bool isEmpty() const noexcept;
+
+
+    template < typename ... ConstructorArgs >
+    bool tryEmplace( ConstructorArgs && ... constructorArgs );
+    bool tryPush( const T & value );
+    bool tryPush( T && value );
+    template < typename InputIterator >
+    SizeType tryPushBatch( InputIterator first, InputIterator last );
+
+    bool tryPop( T & value );
+    template < typename OutputIterator >
+    SizeType tryPopBatch( OutputIterator output, SizeType maximum );
+
+private:
+    typedef typename ::std::aligned_storage< sizeof( T ), alignof( T ) >::type Storage;
+
+
+    T & elementAt( SizeType index ) noexcept;
+
+
+    const SizeType myMask;
+    const ::std::unique_ptr< Storage[] > myElements;
+
+    /// The index of the next element to pop, written by the consumer.
+    alignas( ELY_CACHE_LINE_SIZE ) ::std::atomic< SizeType > myHead;
+    /// The last value of \c myTail read by the consumer.
+    SizeType myCachedTail;
+
+    /// The index of the next element to push, written by the producer.
+    alignas( ELY_CACHE_LINE_SIZE ) ::std::atomic< SizeType > myTail;
+    /// The last value of \c myHead read by the producer.
+    SizeType myCachedHead;
+};
+
+
+namespace detail
+{
+
+
+/*!
+ * \brief Round a capacity up to a power of two.
+ *
+ * \param capacity The capacity wanted.
+ *
+ * \return The smallest power of two greater than or equal to \p capacity , at least \c 2 .
+ */
+inline ::std::size_t roundCapacity( ::std::size_t capacity ) noexcept
+{
+    ::std::size_t rounded = 2;
+
+    while ( rounded < capacity )
+    {
+        rounded <<= 1;
+    }
+
+    return rounded;
+}
+
+
+} // namespace ::ely::utilities::detail
+
+
+template < typename T >
+/*!
+ * \brief Accessor
+ *
+ * \return The maximum number of elements in the queue.
+ */
+inline typename SpscQueue< T >::SizeType SpscQueue< T >::getCapacity() const noexcept
+{
+    return myMask + 1;
+}
+
+template < typename T >
+/*!
+ * \brief Accessor
+ *
+ * The value can be outdated as soon as it is returned if the other side is working.
+ *
+ * \return The number of elements in the queue.
+ */
+inline typename SpscQueue< T >::SizeType SpscQueue< T >::getSize() const noexcept
+{
+    const SizeType head = myHead.load( ::std::memory_order_acquire );
+    const SizeType tail = myTail.load( ::std::memory_order_acquire );
+
+    return tail - head;
+}
+
+template < typename T >
+/*!
+ * \brief Check if the queue is empty.
+ *
+ * \return \c true if there is no element in the queue, \c false otherwise.
+ *
+ * \sa getSize()
+ */
+inline bool SpscQueue< T >::isEmpty() const noexcept
+{
+    return 0 == getSize();
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
+
+
+#include "ely/utilities/SpscQueue.tpp"
+
+
+#endif // SPSC_QUEUE_HPP
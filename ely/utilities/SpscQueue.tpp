@@ -0,0 +1,257 @@
+/*!
+ * \file SpscQueue.tpp
+ * 
+ * \author Ely
+ * 
+ * \brief Source file of the SpscQueue class.
+*/
+#include <new>
+#include <utility>
+
+
+namespace ely
+{
+namespace utilities
+{
+
+
+//------------------------------------------//
+//                                          //
+//      Constructors & Destructors          //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+/*!
+ * \brief Constructor
+ *
+ * \param capacity The maximum number of elements, rounded up to a power of two.
+ */
+SpscQueue< T >::SpscQueue( SizeType capacity )
+    : myMask( detail::roundCapacity( capacity ) - 1 ),
+    myElements( new Storage[ myMask + 1 ] ),
+    myHead( 0 ),
+    myCachedTail( 0 ),
+    myTail( 0 ),
+    myCachedHead( 0 )
+{}
+
+template < typename T >
+/*!
+ * \brief Destructor
+ *
+ * Destroys the elements remaining in the queue.
+ */
+SpscQueue< T >::~SpscQueue()
+{
+    const SizeType tail = myTail.load( ::std::memory_order_acquire );
+
+    for ( SizeType head = myHead.load( ::std::memory_order_relaxed ); head != tail; ++head )
+    {
+        elementAt( head ).~T();
+    }
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Public functions             //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+template < typename ... ConstructorArgs >
+/*!
+ * \brief Construct an element at the end of the queue.
+ *
+ * Must only be called by the producer thread.
+ *
+ * \param constructorArgs The arguments to forward to the constructor of the element.
+ *
+ * \return \c true if the element was pushed, \c false if the queue is full.
+ */
+bool SpscQueue< T >::tryEmplace( ConstructorArgs && ... constructorArgs )
+{
+    const SizeType tail = myTail.load( ::std::memory_order_relaxed );
+
+    if ( tail - myCachedHead > myMask )
+    {
+        myCachedHead = myHead.load( ::std::memory_order_acquire );
+
+        if ( tail - myCachedHead > myMask )
+        {
+            return false;
+        }
+    }
+
+    new ( &myElements[ tail & myMask ] ) T( ::std::forward< ConstructorArgs >( constructorArgs ) ... );
+    myTail.store( tail + 1, ::std::memory_order_release );
+
+    return true;
+}
+
+template < typename T >
+/*!
+ * \brief Push a copy of \p value at the end of the queue.
+ *
+ * \param value The value to push.
+ *
+ * \return \c true if the value was pushed, \c false if the queue is full.
+ *
+ * \sa tryEmplace()
+ */
+bool SpscQueue< T >::tryPush( const T & value )
+{
+    return tryEmplace( value );
+}
+
+template < typename T >
+/*!
+ * \brief Move \p value at the end of the queue.
+ *
+ * \param value The value to push, left untouched if the queue is full.
+ *
+ * \return \c true if the value was pushed, \c false if the queue is full.
+ *
+ * \sa tryEmplace()
+ */
+bool SpscQueue< T >::tryPush( T && value )
+{
+    return tryEmplace( ::std::move( value ) );
+}
+
+template < typename T >
+template < typename InputIterator >
+/*!
+ * \brief Push as many elements of the range [ \p first, \p last ) as possible.
+ *
+ * The elements are published to the consumer all at once.\n
+ * Must only be called by the producer thread.
+ *
+ * \param first The first element to push.
+ * \param last  The end of the range.
+ *
+ * \return The number of elements pushed, from \p first .
+ */
+typename SpscQueue< T >::SizeType SpscQueue< T >::tryPushBatch( InputIterator first, InputIterator last )
+{
+    const SizeType tail = myTail.load( ::std::memory_order_relaxed );
+
+    myCachedHead = myHead.load( ::std::memory_order_acquire );
+
+    const SizeType free = myMask + 1 - ( tail - myCachedHead );
+    SizeType count = 0;
+
+    try
+    {
+        for ( ; count < free && first != last; ++count, ++first )
+        {
+            new ( &myElements[ ( tail + count ) & myMask ] ) T( *first );
+        }
+    }
+    catch ( ... )
+    {
+        // Publish the elements already constructed
+        myTail.store( tail + count, ::std::memory_order_release );
+
+        throw;
+    }
+
+    myTail.store( tail + count, ::std::memory_order_release );
+
+    return count;
+}
+
+template < typename T >
+/*!
+ * \brief Pop the first element of the queue.
+ *
+ * Must only be called by the consumer thread.
+ *
+ * \param value The variable receiving the element.
+ *
+ * \return \c true if an element was popped, \c false if the queue is empty.
+ */
+bool SpscQueue< T >::tryPop( T & value )
+{
+    const SizeType head = myHead.load( ::std::memory_order_relaxed );
+
+    if ( head == myCachedTail )
+    {
+        myCachedTail = myTail.load( ::std::memory_order_acquire );
+
+        if ( head == myCachedTail )
+        {
+            return false;
+        }
+    }
+
+    T & element = elementAt( head );
+
+    value = ::std::move( element );
+    element.~T();
+    myHead.store( head + 1, ::std::memory_order_release );
+
+    return true;
+}
+
+template < typename T >
+template < typename OutputIterator >
+/*!
+ * \brief Pop up to \p maximum elements.
+ *
+ * The space of the elements is given back to the producer all at once.\n
+ * Must only be called by the consumer thread.
+ *
+ * \param output    The iterator receiving the elements.
+ * \param maximum   The maximum number of elements to pop.
+ *
+ * \return The number of elements popped.
+ */
+typename SpscQueue< T >::SizeType SpscQueue< T >::tryPopBatch( OutputIterator output, SizeType maximum )
+{
+    const SizeType head = myHead.load( ::std::memory_order_relaxed );
+
+    myCachedTail = myTail.load( ::std::memory_order_acquire );
+
+    SizeType count = 0;
+
+    try
+    {
+        for ( ; count < maximum && head + count != myCachedTail; ++count, ++output )
+        {
+            T & element = elementAt( head + count );
+
+            *output = ::std::move( element );
+            element.~T();
+        }
+    }
+    catch ( ... )
+    {
+        // Give back the space of the elements already popped
+        myHead.store( head + count, ::std::memory_order_release );
+
+        throw;
+    }
+
+    myHead.store( head + count, ::std::memory_order_release );
+
+    return count;
+}
+
+
+//------------------------------------------//
+//                                          //
+//             Private functions            //
+//                                          //
+//------------------------------------------//
+
+template < typename T >
+inline T & SpscQueue< T >::elementAt( SizeType index ) noexcept
+{
+    return *reinterpret_cast< T * >( &myElements[ index & myMask ] );
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
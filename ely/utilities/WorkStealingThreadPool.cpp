@@ -0,0 +1,255 @@
+#include "ely/utilities/WorkStealingThreadPool.hpp"
+
+
+#include <utility>
+
+
+namespace ely
+{
+namespace utilities
+{
+namespace
+{
+
+
+/// The pool running the current thread, \c nullptr outside of any pool.
+thread_local const WorkStealingThreadPool * currentPool = nullptr;
+/// The index of the queue of the current thread in its pool.
+thread_local ::std::size_t currentIndex = 0;
+
+
+} // namespace
+
+
+//
+// Constructors && Destructor
+//
+
+/*!
+ * \brief Constructor
+ *
+ * Create a pool and start its threads.
+ *
+ * \param numberOfThreads     The number of threads, at least one thread is started.
+ */
+WorkStealingThreadPool::WorkStealingThreadPool( SizeType numberOfThreads )
+    : myQueues(),
+    myThreads(),
+    myQueuedTasks( 0 ),
+    myPendingTasks( 0 ),
+    myNextQueue( 0 ),
+    myMutex(),
+    myTaskAvailable(),
+    myTasksFinished(),
+    myException(),
+    myIsStopping( false )
+{
+    if ( 0 == numberOfThreads )
+    {
+        numberOfThreads = 1;
+    }
+
+    for ( SizeType i = 0; i < numberOfThreads; ++i )
+    {
+        myQueues.emplace_back( new WorkQueue );
+    }
+
+    myThreads.reserve( numberOfThreads );
+
+    for ( SizeType i = 0; i < numberOfThreads; ++i )
+    {
+        myThreads.emplace_back( [ this, i ] { run( i ); } );
+    }
+}
+
+/*!
+ * \brief Destructor
+ *
+ * Wait for every task to be finished and stop the threads.
+ */
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        ::std::unique_lock< ::std::mutex > lock( myMutex );
+
+        myTasksFinished.wait( lock, [ this ] { return 0 == myPendingTasks; } );
+        myIsStopping = true;
+    }
+
+    myTaskAvailable.notify_all();
+
+    for ( auto & thread : myThreads )
+    {
+        thread.join();
+    }
+}
+
+
+//
+// Public functions
+//
+
+/*!
+ * \brief Submit a task.
+ *
+ * Can be called by the tasks themselves.
+ *
+ * \param task    The task to run.
+ */
+void WorkStealingThreadPool::submit( Task task )
+{
+    const SizeType index = ( this == currentPool ) ? currentIndex : myNextQueue++ % myQueues.size();
+    WorkQueue & queue = *myQueues[ index ];
+
+    ++myPendingTasks;
+
+    {
+        ::std::lock_guard< ::std::mutex > lock( queue.mutex );
+
+        queue.tasks.push_back( ::std::move( task ) );
+    }
+
+    ++myQueuedTasks;
+
+    // Taking the lock prevents a thread from missing the notification between its check and its wait
+    {
+        ::std::lock_guard< ::std::mutex > lock( myMutex );
+    }
+
+    myTaskAvailable.notify_one();
+}
+
+/*!
+ * \brief Wait for every submitted task to be finished.
+ *
+ * Must not be called by a task of the pool.
+ *
+ * \exception Any exception thrown by a task since the last call, only the first one is kept.
+ */
+void WorkStealingThreadPool::wait()
+{
+    ::std::exception_ptr exception;
+
+    {
+        ::std::unique_lock< ::std::mutex > lock( myMutex );
+
+        myTasksFinished.wait( lock, [ this ] { return 0 == myPendingTasks; } );
+        ::std::swap( exception, myException );
+    }
+
+    if ( exception )
+    {
+        ::std::rethrow_exception( exception );
+    }
+}
+
+
+//
+// Private functions
+//
+
+/*!
+ * \brief The loop of a thread of the pool.
+ *
+ * \param index   The index of the queue of the thread.
+ */
+void WorkStealingThreadPool::run( SizeType index )
+{
+    currentPool = this;
+    currentIndex = index;
+
+    Task task;
+
+    for ( ; ; )
+    {
+        if ( tryPop( index, task ) )
+        {
+            try
+            {
+                task();
+            }
+            catch ( ... )
+            {
+                ::std::lock_guard< ::std::mutex > lock( myMutex );
+
+                if ( ! myException )
+                {
+                    myException = ::std::current_exception();
+                }
+            }
+
+            task = nullptr;
+            finish();
+        }
+        else
+        {
+            ::std::unique_lock< ::std::mutex > lock( myMutex );
+
+            myTaskAvailable.wait( lock, [ this ] { return myIsStopping || 0 != myQueuedTasks; } );
+
+            if ( myIsStopping )
+            {
+                return;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Take a task.
+ *
+ * Takes the newest task of the thread \p index or steals the oldest task of another thread.
+ *
+ * \param index   The index of the queue of the thread.
+ * \param task    The task taken.
+ *
+ * \return \c true if a task has been taken, \c false if every queue is empty.
+ */
+bool WorkStealingThreadPool::tryPop( SizeType index, Task & task )
+{
+    for ( SizeType i = 0; i < myQueues.size(); ++i )
+    {
+        const SizeType victim = ( index + i ) % myQueues.size();
+        WorkQueue & queue = *myQueues[ victim ];
+        ::std::lock_guard< ::std::mutex > lock( queue.mutex );
+
+        if ( ! queue.tasks.empty() )
+        {
+            if ( victim == index )
+            {
+                task = ::std::move( queue.tasks.back() );
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = ::std::move( queue.tasks.front() );
+                queue.tasks.pop_front();
+            }
+
+            --myQueuedTasks;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * \brief Mark a task as finished and wake up the waiting threads when it was the last one.
+ */
+void WorkStealingThreadPool::finish() noexcept
+{
+    if ( 0 == --myPendingTasks )
+    {
+        {
+            ::std::lock_guard< ::std::mutex > lock( myMutex );
+        }
+
+        myTasksFinished.notify_all();
+    }
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
@@ -0,0 +1,116 @@
+/*!
+ * \file WorkStealingThreadPool.hpp
+ *
+ * \author Ely
+ *
+ * \brief Header file of the WorkStealingThreadPool class.
+ */
+#ifndef WORK_STEALING_THREAD_POOL_HPP
+#define WORK_STEALING_THREAD_POOL_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+#include "ely/config.hpp"
+
+
+namespace ely
+{
+namespace utilities
+{
+
+
+/*!
+ * \brief The WorkStealingThreadPool class
+ *
+ * A pool of threads running tasks which can submit other tasks.\n\n
+ *
+ * Each thread owns a queue of tasks : a task submitted by a thread of the pool goes
+ * in the queue of this thread, which runs its own tasks last in first out so recursive
+ * work stays local and the number of pending tasks stays small.\n
+ * A thread without task steals the oldest task of another thread, the one most likely
+ * to produce a large amount of work.\n
+ * A task submitted from outside the pool goes in the queues in turn.\n\n
+ *
+ * The first exception thrown by a task is rethrown by \c wait() .
+ */
+class WorkStealingThreadPool final
+{
+public:
+    /// The type of the tasks.
+    typedef ::std::function< void() > Task;
+    /// The type of the sizes.
+    typedef ::std::size_t SizeType;
+
+
+    explicit WorkStealingThreadPool( SizeType numberOfThreads = ::std::thread::hardware_concurrency() );
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool( const WorkStealingThreadPool & ) = delete;
+    WorkStealingThreadPool & operator =( const WorkStealingThreadPool & ) = delete;
+
+
+    SizeType getNumberOfThreads() const noexcept;
+
+
+    void submit( Task task );
+    void wait();
+
+private:
+    /// The queue of tasks of a thread.
+    struct alignas( ELY_CACHE_LINE_SIZE ) WorkQueue
+    {
+        ::std::mutex mutex;
+        ::std::deque< Task > tasks;
+    };
+
+
+    void run( SizeType index );
+    bool tryPop( SizeType index, Task & task );
+    void finish() noexcept;
+
+
+    ::std::vector< ::std::unique_ptr< WorkQueue > > myQueues;
+    ::std::vector< ::std::thread > myThreads;
+
+    /// The number of tasks in the queues.
+    ::std::atomic< SizeType > myQueuedTasks;
+    /// The number of tasks submitted and not finished yet.
+    ::std::atomic< SizeType > myPendingTasks;
+    /// The queue receiving the next task submitted from outside the pool.
+    ::std::atomic< SizeType > myNextQueue;
+
+    ::std::mutex myMutex;
+    ::std::condition_variable myTaskAvailable;
+    ::std::condition_variable myTasksFinished;
+    ::std::exception_ptr myException;
+    bool myIsStopping;
+};
+
+
+/*!
+ * \brief Accessor
+ *
+ * \return The number of threads of the pool.
+ */
+inline WorkStealingThreadPool::SizeType WorkStealingThreadPool::getNumberOfThreads() const noexcept
+{
+    return myThreads.size();
+}
+
+
+} // namespace ::ely::utilities
+} // namespace ::ely
+
+
+#endif // WORK_STEALING_THREAD_POOL_HPP
@@ -7,11 +7,17 @@
 CONFIG(debug, debug|release):TARGET = elyd
 else:CONFIG(release, debug|release):TARGET = ely
 TEMPLATE = lib
-CONFIG += staticlib c++14
+CONFIG += staticlib c++17
 CONFIG -= qt
 
 #QMAKE_CXXFLAGS += -std=c++11
 
+# Build with "qmake CONFIG+=tsan" to run the stress tests under ThreadSanitizer
+CONFIG(tsan) {
+    QMAKE_CXXFLAGS += -fsanitize=thread -fno-omit-frame-pointer
+    QMAKE_LFLAGS += -fsanitize=thread
+}
+
 win32:target.path = $(PWD)/lib/
 else:unix:target.path = $(PWD)/lib/
 INSTALLS += target
@@ -28,7 +34,29 @@ SOURCES += \
     ely/utilities/NoLogPolicy.cpp \
     ely/utilities/DebugLogPolicy.cpp \
     ely/utilities/log.cpp \
-    ely/file_system/AbstractFile.cpp
+    ely/file_system/AbstractFile.cpp \
+    ely/file_system/PathView.cpp \
+    ely/file_system/PathTable.cpp \
+    ely/file_system/separators.cpp \
+    ely/file_system/normalization.cpp \
+    ely/file_system/Directory.cpp \
+    ely/file_system/DirectoryWalker.cpp \
+    ely/file_system/MappedFile.cpp \
+    ely/file_system/operations.cpp \
+    ely/file_system/AsyncIoContext.cpp \
+    ely/file_system/AsyncFile.cpp \
+    ely/file_system/OpenMode.cpp \
+    ely/file_system/AlignedBuffer.cpp \
+    ely/file_system/BufferedWriter.cpp \
+    ely/file_system/LineReader.cpp \
+    ely/file_system/ChunkedReader.cpp \
+    ely/file_system/AtomicFileWriter.cpp \
+    ely/file_system/FileHandleCache.cpp \
+    ely/file_system/FileStatus.cpp \
+    ely/file_system/StatusCache.cpp \
+    ely/file_system/FileWatcher.cpp \
+    ely/utilities/WorkStealingThreadPool.cpp \
+    ely/signals_slots/SignalsSlots.cpp
 
 OTHER_FILES += \
     ely/patterns/Factory.tpp \
@@ -37,7 +65,14 @@ OTHER_FILES += \
     ely/signals_slots/Signal.tpp \
     ely/signals_slots/Slot.tpp \
     ely/signals_slots/connect.tpp \
-    ely/signals_slots/AbstractCallableObject.tpp
+    ely/signals_slots/AbstractCallableObject.tpp \
+    ely/signals_slots/SignalBlocker.tpp \
+    ely/signals_slots/BlockableSignal.tpp \
+    ely/signals_slots/SignalRecorder.tpp \
+    ely/signals_slots/SignalReplayer.tpp \
+    ely/file_system/Path.tpp \
+    ely/utilities/SpscQueue.tpp \
+    ely/utilities/MpmcQueue.tpp
 
 HEADERS += \
     ely/date_time/exception/DateException.hpp \
@@ -65,6 +100,27 @@ HEADERS += \
     ely/patterns/Composite.hpp \
     ely/file_system/Path.hpp \
     ely/file_system/FilePath.hpp \
+    ely/file_system/PathView.hpp \
+    ely/file_system/PathTable.hpp \
+    ely/file_system/separators.hpp \
+    ely/file_system/normalization.hpp \
+    ely/file_system/Directory.hpp \
+    ely/file_system/DirectoryWalker.hpp \
+    ely/file_system/MappedFile.hpp \
+    ely/file_system/operations.hpp \
+    ely/file_system/AsyncIoContext.hpp \
+    ely/file_system/AsyncFile.hpp \
+    ely/file_system/OpenMode.hpp \
+    ely/file_system/AlignedBuffer.hpp \
+    ely/file_system/BufferedWriter.hpp \
+    ely/file_system/LineReader.hpp \
+    ely/file_system/ChunkedReader.hpp \
+    ely/file_system/AtomicFileWriter.hpp \
+    ely/file_system/FileHandleCache.hpp \
+    ely/file_system/FileStatus.hpp \
+    ely/file_system/StatusCache.hpp \
+    ely/file_system/FileWatcher.hpp \
+    ely/utilities/WorkStealingThreadPool.hpp \
     ely/utilities/NoLogPolicy.hpp \
     ely/utilities/DebugLogPolicy.hpp \
     ely/utilities/FileLogPolicy.hpp \
@@ -74,5 +130,14 @@ HEADERS += \
     ely/signals_slots/connect.hpp \
     ely/signals_slots/AbstractCallableObject.hpp \
     ely/signals_slots/SignalsSlots.hpp \
+    ely/signals_slots/SignalBlocker.hpp \
+    ely/signals_slots/AbstractSignal.hpp \
+    ely/signals_slots/BlockableSignal.hpp \
+    ely/signals_slots/SignalRecorder.hpp \
+    ely/signals_slots/SignalReplayer.hpp \
+    ely/signals_slots/Serializer.hpp \
+    ely/signals_slots/instantiation.hpp \
     ely/utilities/bind.hpp \
-    ely/utilities/IntegerSequence.hpp
+    ely/utilities/IntegerSequence.hpp \
+    ely/utilities/SpscQueue.hpp \
+    ely/utilities/MpmcQueue.hpp
@@ -0,0 +1,371 @@
+/*!
+ * \file SignalsSlots.cpp
+ *
+ * \brief Stress tests program.
+ *
+ * \author Ely
+ *
+ * Stress test program for the signals/slots system.\n
+ * Many threads connect, disconnect, destroy and emit signals and slots with
+ * a randomized schedule while a model of the connections checks that :
+ * - no slot is called by a signal once the disconnection has returned,
+ * - no connection is lost.
+ *
+ * The schedule can be reproduced with the environment variables
+ * \e ELY_STRESS_SEED and \e ELY_STRESS_OPERATIONS.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+#include <ely/signals_slots/SignalsSlots.hpp>
+
+
+using ::ely::signals_slots::Signal;
+using ::ely::signals_slots::Slot;
+using ::ely::signals_slots::connect;
+using ::ely::signals_slots::disconnect;
+
+
+namespace
+{
+
+
+const ::std::size_t numberOfSignals = 4;
+const ::std::size_t numberOfWorkers = 4;
+const ::std::size_t numberOfEmitters = 2;
+const ::std::size_t slotsPerWorker = 6;
+
+
+unsigned long environmentValue( const char * name, unsigned long defaultValue )
+{
+    const char * value = ::std::getenv( name );
+
+    return ( nullptr != value ) ? ::std::strtoul( value, nullptr, 10 ) : defaultValue;
+}
+
+
+/// The signals shared by every threads, a signal always emits its own index.
+typedef ::std::array< Signal< int >, numberOfSignals > SharedSignals;
+
+
+/// A slot which records by which signals it is called and checks it is allowed to.
+class Probe
+{
+public:
+    explicit Probe( ::std::atomic< ::std::size_t > & violations )
+        : myViolations( violations )
+    {
+        for ( ::std::size_t i = 0; i < numberOfSignals; ++i )
+        {
+            myIsUnreachable[ i ] = true;
+            myCalls[ i ] = 0;
+        }
+
+        slot.bind( [ this ]( int signal ) { onCall( signal ); } );
+    }
+
+    void setUnreachable( ::std::size_t signal, bool isUnreachable )
+    {
+        myIsUnreachable[ signal ] = isUnreachable;
+    }
+
+    ::std::size_t getCalls( ::std::size_t signal ) const
+    {
+        return myCalls[ signal ];
+    }
+
+    void resetCalls()
+    {
+        for ( auto & calls : myCalls )
+        {
+            calls = 0;
+        }
+    }
+
+private:
+    void onCall( int signal )
+    {
+        if ( myIsUnreachable[ signal ] )
+        {
+            ++myViolations;
+        }
+
+        ++myCalls[ signal ];
+    }
+
+
+    ::std::atomic< ::std::size_t > & myViolations;
+    ::std::array< ::std::atomic< bool >, numberOfSignals > myIsUnreachable;
+    ::std::array< ::std::atomic< ::std::size_t >, numberOfSignals > myCalls;
+
+public:
+    // Declared last to be disconnected before the other members are destroyed
+    Slot< int > slot;
+};
+
+
+/// The connections a worker is expected to have made.
+struct Model
+{
+    bool reaches( ::std::size_t probe, ::std::size_t signal ) const
+    {
+        return 0 != expectedCalls( probe, signal );
+    }
+
+    ::std::size_t expectedCalls( ::std::size_t probe, ::std::size_t signal ) const
+    {
+        return ( direct[ probe ][ signal ] ? 1 : 0 ) + ( ( relayed[ signal ] && fromRelay[ probe ] ) ? 1 : 0 );
+    }
+
+
+    /// The probes directly connected to a shared signal.
+    ::std::array< ::std::array< bool, numberOfSignals >, slotsPerWorker > direct {};
+    /// The shared signals connected to the relay of the worker.
+    ::std::array< bool, numberOfSignals > relayed {};
+    /// The probes connected to the relay of the worker.
+    ::std::array< bool, slotsPerWorker > fromRelay {};
+};
+
+
+/// A thread randomly changing its own connections to the shared signals.
+class Worker
+{
+public:
+    Worker( SharedSignals & signals, ::std::atomic< ::std::size_t > & violations, unsigned long seed )
+        : mySignals( signals ),
+        myViolations( violations ),
+        myRandom( seed ),
+        myRelay( new Signal< int > )
+    {
+        for ( auto & probe : myProbes )
+        {
+            probe.reset( new Probe( myViolations ) );
+        }
+    }
+
+    void run( unsigned long operations )
+    {
+        ::std::uniform_int_distribution< ::std::size_t > randomSignal( 0, numberOfSignals - 1 );
+        ::std::uniform_int_distribution< ::std::size_t > randomProbe( 0, slotsPerWorker - 1 );
+        ::std::uniform_int_distribution< int > randomOperation( 0, 8 );
+
+        for ( unsigned long i = 0; i < operations; ++i )
+        {
+            const ::std::size_t signal = randomSignal( myRandom );
+            const ::std::size_t probe = randomProbe( myRandom );
+            Model next( myModel );
+
+            switch ( randomOperation( myRandom ) )
+            {
+            case 0 :
+                next.direct[ probe ][ signal ] = true;
+                apply( next, [ & ] { connect( mySignals[ signal ], myProbes[ probe ]->slot ); } );
+                break;
+
+            case 1 :
+                next.direct[ probe ][ signal ] = false;
+                apply( next, [ & ] { disconnect( mySignals[ signal ], myProbes[ probe ]->slot ); } );
+                break;
+
+            case 2 :
+                next.direct[ probe ].fill( false );
+                next.fromRelay[ probe ] = false;
+                apply( next, [ & ] { myProbes[ probe ].reset( new Probe( myViolations ) ); } );
+                break;
+
+            case 3 :
+                next.relayed[ signal ] = true;
+                apply( next, [ & ] { connect( mySignals[ signal ], *myRelay ); } );
+                break;
+
+            case 4 :
+                next.relayed[ signal ] = false;
+                apply( next, [ & ] { disconnect( mySignals[ signal ], *myRelay ); } );
+                break;
+
+            case 5 :
+                next.fromRelay[ probe ] = true;
+                apply( next, [ & ] { connect( *myRelay, myProbes[ probe ]->slot ); } );
+                break;
+
+            case 6 :
+                next.fromRelay[ probe ] = false;
+                apply( next, [ & ] { disconnect( *myRelay, myProbes[ probe ]->slot ); } );
+                break;
+
+            case 7 :
+                next.relayed.fill( false );
+                next.fromRelay.fill( false );
+                apply( next, [ & ] { myRelay.reset( new Signal< int > ); } );
+                break;
+
+            default :
+                mySignals[ signal ]( static_cast< int >( signal ) );
+                break;
+            }
+        }
+    }
+
+    void resetCalls()
+    {
+        for ( auto & probe : myProbes )
+        {
+            probe->resetCalls();
+        }
+    }
+
+    /// Counts the calls which don't match the connections of the model.
+    ::std::size_t countLostConnections() const
+    {
+        ::std::size_t mismatches = 0;
+
+        for ( ::std::size_t probe = 0; probe < slotsPerWorker; ++probe )
+        {
+            for ( ::std::size_t signal = 0; signal < numberOfSignals; ++signal )
+            {
+                if ( myModel.expectedCalls( probe, signal ) != myProbes[ probe ]->getCalls( signal ) )
+                {
+                    ++mismatches;
+                }
+            }
+        }
+
+        return mismatches;
+    }
+
+private:
+    template < typename Operation >
+    /*!
+     * \brief Applies an operation and updates what the probes are allowed to receive.
+     *
+     * A probe is allowed to be called before a connection starts and until a disconnection returns.
+     */
+    void apply( const Model & next, Operation operation )
+    {
+        for ( ::std::size_t probe = 0; probe < slotsPerWorker; ++probe )
+        {
+            for ( ::std::size_t signal = 0; signal < numberOfSignals; ++signal )
+            {
+                if ( ! myModel.reaches( probe, signal ) && next.reaches( probe, signal ) )
+                {
+                    myProbes[ probe ]->setUnreachable( signal, false );
+                }
+            }
+        }
+
+        operation();
+
+        for ( ::std::size_t probe = 0; probe < slotsPerWorker; ++probe )
+        {
+            for ( ::std::size_t signal = 0; signal < numberOfSignals; ++signal )
+            {
+                if ( ! next.reaches( probe, signal ) )
+                {
+                    myProbes[ probe ]->setUnreachable( signal, true );
+                }
+            }
+        }
+
+        myModel = next;
+    }
+
+
+    SharedSignals & mySignals;
+    ::std::atomic< ::std::size_t > & myViolations;
+    ::std::mt19937 myRandom;
+    Model myModel;
+    ::std::unique_ptr< Signal< int > > myRelay;
+    ::std::array< ::std::unique_ptr< Probe >, slotsPerWorker > myProbes;
+};
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( signals_slots )
+
+BOOST_AUTO_TEST_CASE( concurrent_connections )
+{
+    const unsigned long seed = environmentValue( "ELY_STRESS_SEED", ::std::random_device()() );
+    const unsigned long operations = environmentValue( "ELY_STRESS_OPERATIONS", 20000 );
+
+    BOOST_TEST_MESSAGE( "ELY_STRESS_SEED=" << seed << " ELY_STRESS_OPERATIONS=" << operations );
+
+    SharedSignals signals;
+    ::std::atomic< ::std::size_t > violations( 0 );
+    ::std::atomic< bool > isRunning( true );
+    ::std::vector< ::std::unique_ptr< Worker > > workers;
+    ::std::vector< ::std::thread > threads;
+
+    for ( ::std::size_t i = 0; i < numberOfWorkers; ++i )
+    {
+        workers.emplace_back( new Worker( signals, violations, seed + i ) );
+    }
+
+    for ( ::std::size_t i = 0; i < numberOfEmitters; ++i )
+    {
+        threads.emplace_back( [ &, i ]
+        {
+            ::std::mt19937 random( seed + numberOfWorkers + i );
+            ::std::uniform_int_distribution< ::std::size_t > randomSignal( 0, numberOfSignals - 1 );
+
+            while ( isRunning )
+            {
+                const ::std::size_t signal = randomSignal( random );
+
+                signals[ signal ]( static_cast< int >( signal ) );
+            }
+        } );
+    }
+
+    ::std::vector< ::std::thread > workerThreads;
+
+    for ( auto & worker : workers )
+    {
+        workerThreads.emplace_back( [ &worker, operations ] { worker->run( operations ); } );
+    }
+
+    for ( auto & thread : workerThreads )
+    {
+        thread.join();
+    }
+
+    isRunning = false;
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL( violations, 0u );
+
+    // Every remaining connection must be called exactly once per emission
+    for ( auto & worker : workers )
+    {
+        worker->resetCalls();
+    }
+
+    for ( ::std::size_t signal = 0; signal < numberOfSignals; ++signal )
+    {
+        signals[ signal ]( static_cast< int >( signal ) );
+    }
+
+    for ( auto & worker : workers )
+    {
+        BOOST_CHECK_EQUAL( worker->countLostConnections(), 0u );
+    }
+
+    BOOST_CHECK_EQUAL( violations, 0u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
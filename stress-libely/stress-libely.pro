@@ -0,0 +1,37 @@
+TEMPLATE = app
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# Build with "qmake CONFIG+=tsan" to run the stress tests under ThreadSanitizer
+CONFIG(tsan) {
+    QMAKE_CXXFLAGS += -fsanitize=thread -fno-omit-frame-pointer
+    QMAKE_LFLAGS += -fsanitize=thread
+}
+
+# For libely
+INCLUDEPATH += $$PWD/../
+
+LIBS += -L$$PWD/../
+
+CONFIG(debug, debug|release):LIBS += -lelyd
+else:CONFIG(release, debug|release):LIBS += -lely
+
+# For boost
+win32 {
+    INCLUDEPATH += D:/dev/boost_1_57_0/include
+    
+    LIBS += -LD:/dev/boost_1_57_0/lib
+    
+    CONFIG(debug, debug|release):LIBS += D:/dev/boost_1_57_0/lib/libboost_unit_test_framework-mgw48-mt-d-1_57.a
+    else:CONFIG(release, debug|release):LIBS += D:/dev/boost_1_57_0/lib/libboost_unit_test_framework-mgw48-mt-1_57.a
+} else:unix {
+    LIBS += -lboost_unit_test_framework -pthread
+}
+
+
+SOURCES += main.cpp \
+    signals_slots/SignalsSlots.cpp \
+    utilities/MpmcQueue.cpp
+
+HEADERS +=
@@ -0,0 +1,165 @@
+/*!
+ * \file MpmcQueue.cpp
+ *
+ * \brief Stress tests program.
+ *
+ * \author Ely
+ *
+ * Stress test program for the MpmcQueue class.\n
+ * Many producers push single elements and batches while many consumers pop them,
+ * every element must be popped exactly once and in the order of its producer.
+ *
+ * The number of elements per producer can be changed with the environment variable
+ * \e ELY_STRESS_OPERATIONS.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+
+#include <ely/utilities/MpmcQueue.hpp>
+
+
+using ::ely::utilities::MpmcQueue;
+
+
+namespace
+{
+
+
+const ::std::size_t numberOfProducers = 3;
+const ::std::size_t numberOfConsumers = 3;
+const ::std::size_t batchSize = 5;
+
+
+unsigned long environmentValue( const char * name, unsigned long defaultValue )
+{
+    const char * value = ::std::getenv( name );
+
+    return ( nullptr != value ) ? ::std::strtoul( value, nullptr, 10 ) : defaultValue;
+}
+
+
+/// An element knowing its producer and its rank among the elements of its producer.
+struct Element
+{
+    ::std::size_t producer;
+    unsigned long rank;
+};
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( utilities )
+
+BOOST_AUTO_TEST_CASE( mpmc_queue_exactly_once )
+{
+    const unsigned long operations = environmentValue( "ELY_STRESS_OPERATIONS", 20000 );
+
+    MpmcQueue< Element > queue( 16 );
+    ::std::array< ::std::vector< ::std::atomic< unsigned int > >, numberOfProducers > deliveries;
+    ::std::atomic< unsigned long > popped( 0 );
+    ::std::atomic< ::std::size_t > disorders( 0 );
+    ::std::vector< ::std::thread > threads;
+
+    for ( auto & producerDeliveries : deliveries )
+    {
+        producerDeliveries = ::std::vector< ::std::atomic< unsigned int > >( operations );
+    }
+
+    for ( ::std::size_t producer = 0; producer < numberOfProducers; ++producer )
+    {
+        threads.emplace_back( [ &, producer ]
+        {
+            unsigned long rank = 0;
+
+            while ( rank < operations )
+            {
+                // Alternates single elements and batches
+                if ( 0 == rank % 2 )
+                {
+                    rank += queue.tryPush( Element { producer, rank } ) ? 1 : 0;
+                }
+                else
+                {
+                    ::std::array< Element, batchSize > batch;
+                    ::std::size_t size = 0;
+
+                    for ( ; size < batchSize && rank + size < operations; ++size )
+                    {
+                        batch[ size ] = Element { producer, rank + size };
+                    }
+
+                    rank += queue.tryPushBatch( batch.begin(), batch.begin() + size );
+                }
+
+                ::std::this_thread::yield();
+            }
+        } );
+    }
+
+    for ( ::std::size_t consumer = 0; consumer < numberOfConsumers; ++consumer )
+    {
+        threads.emplace_back( [ & ]
+        {
+            ::std::array< unsigned long, numberOfProducers > lastRanks {};
+            ::std::array< bool, numberOfProducers > hasPopped {};
+            ::std::array< Element, batchSize > batch;
+
+            while ( popped < operations * numberOfProducers )
+            {
+                const ::std::size_t size = queue.tryPopBatch( batch.begin(), batchSize );
+
+                for ( ::std::size_t i = 0; i < size; ++i )
+                {
+                    const Element & element = batch[ i ];
+
+                    // A consumer pops the elements of a producer in their order
+                    if ( hasPopped[ element.producer ] && element.rank <= lastRanks[ element.producer ] )
+                    {
+                        ++disorders;
+                    }
+
+                    hasPopped[ element.producer ] = true;
+                    lastRanks[ element.producer ] = element.rank;
+                    ++deliveries[ element.producer ][ element.rank ];
+                }
+
+                popped += size;
+
+                if ( 0 == size )
+                {
+                    ::std::this_thread::yield();
+                }
+            }
+        } );
+    }
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    ::std::size_t mismatches = 0;
+
+    for ( auto & producerDeliveries : deliveries )
+    {
+        for ( auto & count : producerDeliveries )
+        {
+            mismatches += ( 1 == count ) ? 0 : 1;
+        }
+    }
+
+    BOOST_CHECK_EQUAL( mismatches, 0u );
+    BOOST_CHECK_EQUAL( disorders, 0u );
+    BOOST_CHECK( queue.isEmpty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,258 @@
+/*!
+ * \file AsyncFile.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the AsyncFile and AsyncIoContext classes.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/AsyncFile.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+const AsyncIoContext::Backend backends[] = { AsyncIoContext::Backend::IoUring, AsyncIoContext::Backend::ThreadPool };
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( async_file )
+
+BOOST_AUTO_TEST_CASE( read_write )
+{
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary;
+        AsyncIoContext context( 8, backend );
+        AsyncFile file( context, FilePath( temporary.path ), OpenMode::ReadWrite | OpenMode::Create );
+
+        BOOST_REQUIRE( file.isOpen() );
+        BOOST_CHECK_EQUAL( file.getError(), 0 );
+
+        const std::string content( "#!/bin/sh\necho ely\n" );
+        std::future< std::size_t > written = file.write( 0, content.data(), content.size() );
+
+        context.submit();
+        BOOST_CHECK_EQUAL( written.get(), content.size() );
+
+        // Past the end of the file
+        std::string buffer( 64, '\0' );
+        std::future< std::size_t > read = file.read( 10, &buffer[ 0 ], buffer.size() );
+        std::future< std::size_t > end = file.read( 100, &buffer[ 0 ], buffer.size() );
+
+        context.submit();
+        BOOST_CHECK_EQUAL( read.get(), content.size() - 10 );
+        BOOST_CHECK_EQUAL( buffer.substr( 0, content.size() - 10 ), "echo ely\n" );
+        BOOST_CHECK_EQUAL( end.get(), 0u );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( errors )
+{
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary;
+        AsyncIoContext context( 4, backend );
+        AsyncFile missing( context, FilePath( temporary.path + ".missing" ) );
+
+        BOOST_CHECK( ! missing.isOpen() );
+        BOOST_CHECK_EQUAL( missing.getError(), ENOENT );
+
+        char buffer[ 16 ];
+        std::future< std::size_t > read = missing.read( 0, buffer, sizeof( buffer ) );
+
+        context.submit();
+        BOOST_CHECK_THROW( read.get(), std::system_error );
+
+        // Writing a read only file
+        AsyncFile file( context, FilePath( temporary.path ) );
+        std::error_code error;
+
+        file.write( 0, buffer, sizeof( buffer ), [ & ]( std::size_t, std::error_code result ) { error = result; } );
+        context.wait();
+
+        BOOST_CHECK( std::errc::bad_file_descriptor == error );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( many_operations )
+{
+    const std::size_t numberOfBlocks = 2000;
+    const std::size_t blockSize = 64;
+
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary;
+        // A small queue is submitted and drained many times
+        AsyncIoContext context( 4, backend );
+        AsyncFile file( context, FilePath( temporary.path ), OpenMode::ReadWrite | OpenMode::Create );
+        std::vector< std::string > blocks;
+
+        for ( std::size_t i = 0; i < numberOfBlocks; ++i )
+        {
+            blocks.emplace_back( blockSize, static_cast< char >( 'a' + i % 26 ) );
+        }
+
+        std::atomic< std::size_t > bytes( 0 );
+
+        for ( std::size_t i = 0; i < numberOfBlocks; ++i )
+        {
+            file.write( i * blockSize, blocks[ i ].data(), blockSize,
+                        [ & ]( std::size_t size, std::error_code ) { bytes += size; } );
+        }
+
+        context.wait();
+
+        BOOST_CHECK_EQUAL( bytes, numberOfBlocks * blockSize );
+
+        std::vector< std::string > readBlocks( numberOfBlocks, std::string( blockSize, '\0' ) );
+        std::atomic< std::size_t > mismatches( 0 );
+
+        for ( std::size_t i = 0; i < numberOfBlocks; ++i )
+        {
+            file.read( i * blockSize, &readBlocks[ i ][ 0 ], blockSize, [ &, i ]( std::size_t size, std::error_code )
+            {
+                if ( blockSize != size || readBlocks[ i ] != blocks[ i ] )
+                {
+                    ++mismatches;
+                }
+            } );
+        }
+
+        context.wait();
+
+        BOOST_CHECK_EQUAL( mismatches, 0u );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( chained_operations )
+{
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary;
+        AsyncIoContext context( 1, backend );
+        AsyncFile file( context, FilePath( temporary.path ), OpenMode::ReadWrite | OpenMode::Create );
+        const std::string content( 100, 'e' );
+        std::size_t offset = 0;
+        std::function< void( std::size_t, std::error_code ) > next;
+
+        // Each callback writes the next byte, the limit of operations in flight must not block it
+        next = [ & ]( std::size_t size, std::error_code )
+        {
+            offset += size;
+
+            if ( offset < content.size() )
+            {
+                file.write( offset, content.data() + offset, 1, next );
+                context.submit();
+            }
+        };
+
+        // A callback starts the next write before its own operation is counted as completed
+        file.write( 0, content.data(), 1, next );
+        context.wait();
+
+        BOOST_CHECK_EQUAL( offset, content.size() );
+
+        char buffer[ 128 ];
+        std::future< std::size_t > read = file.read( 0, buffer, sizeof( buffer ) );
+
+        context.submit();
+        BOOST_CHECK_EQUAL( read.get(), content.size() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( throwing_callbacks )
+{
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary( "ely" );
+        AsyncIoContext context( 4, backend );
+        AsyncFile file( context, FilePath( temporary.path ) );
+        char buffer[ 8 ][ 4 ];
+        std::atomic< std::size_t > calls( 0 );
+
+        for ( auto & part : buffer )
+        {
+            file.read( 0, part, sizeof( part ), [ & ]( std::size_t, std::error_code )
+            {
+                ++calls;
+
+                throw std::runtime_error( "callback" );
+            } );
+        }
+
+        // Every operation is still completed before the first exception is rethrown
+        BOOST_CHECK_THROW( context.wait(), std::runtime_error );
+        BOOST_CHECK_EQUAL( calls, 8u );
+
+        // Only once
+        std::size_t read = 0;
+
+        file.read( 0, buffer[ 0 ], sizeof( buffer[ 0 ] ), [ & ]( std::size_t size, std::error_code ) { read = size; } );
+        BOOST_CHECK_NO_THROW( context.wait() );
+        BOOST_CHECK_EQUAL( read, 3u );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( registered_buffers )
+{
+    for ( AsyncIoContext::Backend backend : backends )
+    {
+        TemporaryFile temporary;
+        AsyncIoContext context( 8, backend );
+        AsyncFile file( context, FilePath( temporary.path ), OpenMode::ReadWrite | OpenMode::Create );
+        std::vector< char > buffer( 4096, 'x' );
+        ::iovec registered = { buffer.data(), buffer.size() };
+
+        BOOST_REQUIRE( context.registerBuffers( &registered, 1 ) );
+
+        std::size_t written = 0;
+        std::size_t read = 0;
+
+        file.writeFixed( 0, buffer.data(), 1024, 0, [ & ]( std::size_t size, std::error_code ) { written = size; } );
+        context.wait();
+
+        std::fill( buffer.begin(), buffer.end(), '\0' );
+        file.readFixed( 0, buffer.data() + 2048, 2048, 0, [ & ]( std::size_t size, std::error_code ) { read = size; } );
+        context.wait();
+
+        BOOST_CHECK_EQUAL( written, 1024u );
+        BOOST_CHECK_EQUAL( read, 1024u );
+        BOOST_CHECK_EQUAL( buffer[ 2048 ], 'x' );
+        BOOST_CHECK_EQUAL( buffer[ 2048 + 1023 ], 'x' );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
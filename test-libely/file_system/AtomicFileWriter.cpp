@@ -0,0 +1,225 @@
+/*!
+ * \file AtomicFileWriter.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the AtomicFileWriter class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/AtomicFileWriter.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+std::size_t countEntries( const std::string & path )
+{
+    std::size_t count = 0;
+    DIR * directory = ::opendir( path.c_str() );
+
+    while ( const ::dirent * entry = ::readdir( directory ) )
+    {
+        const std::string name( entry->d_name );
+
+        count += ( "." != name ) && ( ".." != name );
+    }
+
+    ::closedir( directory );
+
+    return count;
+}
+
+::mode_t permissionsOf( const std::string & path )
+{
+    struct stat status;
+
+    ::stat( path.c_str(), &status );
+
+    return status.st_mode & 07777;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( atomic_file_writer )
+
+BOOST_AUTO_TEST_CASE( commit )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "state" );
+
+    writeFile( path, "former content" );
+    ::chmod( path.c_str(), 0600 );
+
+    {
+        AtomicFileWriter writer{ FilePath( path ) };
+
+        BOOST_REQUIRE( writer.isOpen() );
+        BOOST_CHECK_EQUAL( countEntries( directory.path ), 2u );
+        BOOST_CHECK( writer.write( "new " ) );
+        BOOST_CHECK( writer.write( std::string( "content" ) ) );
+
+        // Unchanged until committed
+        BOOST_CHECK_EQUAL( readFile( path ), "former content" );
+
+        BOOST_CHECK( writer.commit() );
+        BOOST_CHECK( writer.isCommitted() );
+        BOOST_CHECK( ! writer.isOpen() );
+        BOOST_CHECK( ! writer.getError() );
+    }
+
+    BOOST_CHECK_EQUAL( readFile( path ), "new content" );
+    BOOST_CHECK_EQUAL( permissionsOf( path ), 0600u );
+    BOOST_CHECK_EQUAL( countEntries( directory.path ), 1u );
+
+    // A new file
+    const std::string newPath = directory.file( "new" );
+    AtomicFileWriter writer( FilePath( newPath ), 0640 );
+
+    BOOST_CHECK( writer.commit() );
+    BOOST_CHECK_EQUAL( readFile( newPath ), "" );
+    BOOST_CHECK_EQUAL( permissionsOf( newPath ), 0640u );
+}
+
+BOOST_AUTO_TEST_CASE( discard )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "state" );
+
+    writeFile( path, "former content" );
+
+    {
+        AtomicFileWriter writer{ FilePath( path ) };
+
+        writer.write( "partial" );
+    }
+
+    BOOST_CHECK_EQUAL( readFile( path ), "former content" );
+    BOOST_CHECK_EQUAL( countEntries( directory.path ), 1u );
+
+    AtomicFileWriter writer{ FilePath( path ) };
+
+    writer.discard();
+
+    BOOST_CHECK( ! writer.write( "late" ) );
+    BOOST_CHECK( ! writer.commit() );
+    BOOST_CHECK_EQUAL( writer.getError().value(), EBADF );
+    BOOST_CHECK_EQUAL( countEntries( directory.path ), 1u );
+
+    // Missing directory
+    AtomicFileWriter missing( FilePath( directory.file( "missing/state" ) ) );
+
+    BOOST_CHECK( ! missing.isOpen() );
+    BOOST_CHECK_EQUAL( missing.getError().value(), ENOENT );
+    BOOST_CHECK( ! missing.commit() );
+}
+
+BOOST_AUTO_TEST_CASE( group )
+{
+    TemporaryDirectory directory;
+    AtomicFileWriter::Group group;
+    std::vector< std::unique_ptr< AtomicFileWriter > > writers;
+    std::vector< AtomicFileWriter * > pointers;
+
+    for ( int i = 0; i < 50; ++i )
+    {
+        writers.emplace_back( new AtomicFileWriter( FilePath( directory.file( std::to_string( i ) ) ) ) );
+        writers.back()->write( "content " + std::to_string( i ) );
+        pointers.push_back( writers.back().get() );
+    }
+
+    BOOST_CHECK( group.commit( pointers.data(), pointers.size() ) );
+    BOOST_CHECK_EQUAL( group.getNumberOfBatches(), 1u );
+
+    for ( int i = 0; i < 50; ++i )
+    {
+        BOOST_CHECK( writers[ i ]->isCommitted() );
+        BOOST_CHECK_EQUAL( readFile( directory.file( std::to_string( i ) ) ), "content " + std::to_string( i ) );
+    }
+
+    BOOST_CHECK_EQUAL( countEntries( directory.path ), 50u );
+
+    // A failed writer doesn't prevent the others
+    AtomicFileWriter failed( FilePath( directory.file( "failed" ) ) );
+    AtomicFileWriter succeeded( FilePath( directory.file( "succeeded" ) ) );
+    AtomicFileWriter * const both[] = { &failed, &succeeded };
+
+    failed.discard();
+
+    BOOST_CHECK( ! group.commit( both, 2 ) );
+    BOOST_CHECK( ! failed.isCommitted() );
+    BOOST_CHECK( succeeded.isCommitted() );
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_group )
+{
+    TemporaryDirectory directory;
+    AtomicFileWriter::Group group;
+    std::vector< std::thread > threads;
+    std::atomic< int > failures( 0 );
+    const int numberOfThreads = 8;
+    const int numberOfCommits = 20;
+
+    for ( int t = 0; t < numberOfThreads; ++t )
+    {
+        threads.emplace_back( [ &, t ]
+        {
+            for ( int i = 0; i < numberOfCommits; ++i )
+            {
+                AtomicFileWriter writer( FilePath( directory.file( std::to_string( t ) ) ) );
+
+                writer.write( std::to_string( i ) );
+                failures += ! group.commit( writer );
+            }
+        } );
+    }
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL( failures, 0 );
+
+    for ( int t = 0; t < numberOfThreads; ++t )
+    {
+        BOOST_CHECK_EQUAL( readFile( directory.file( std::to_string( t ) ) ), std::to_string( numberOfCommits - 1 ) );
+    }
+
+    BOOST_CHECK_LE( group.getNumberOfBatches(), static_cast< std::uint64_t >( numberOfThreads * numberOfCommits ) );
+    BOOST_CHECK_EQUAL( countEntries( directory.path ), static_cast< std::size_t >( numberOfThreads ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,132 @@
+/*!
+ * \file BufferedWriter.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the BufferedWriter class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/BufferedWriter.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( buffered_writer )
+
+BOOST_AUTO_TEST_CASE( buffering )
+{
+    TemporaryFile temporary;
+    File file( FilePath( temporary.path ), OpenMode::Write | OpenMode::Truncate );
+    BufferedWriter writer( file, 16 );
+
+    BOOST_CHECK_EQUAL( writer.getBufferSize(), 16u );
+
+    // Kept in the buffer
+    BOOST_CHECK( writer.write( "#!/bin/sh\n" ) );
+    BOOST_CHECK_EQUAL( writer.getBufferedSize(), 10u );
+    BOOST_CHECK_EQUAL( writer.getWrittenSize(), 0u );
+    BOOST_CHECK( temporary.read().empty() );
+
+    // Written with the buffer
+    BOOST_CHECK( writer.write( "echo ely\n" ) );
+    BOOST_CHECK_EQUAL( writer.getBufferedSize(), 0u );
+    BOOST_CHECK_EQUAL( writer.getWrittenSize(), 19u );
+    BOOST_CHECK_EQUAL( temporary.read(), "#!/bin/sh\necho ely\n" );
+
+    // Larger than the buffer
+    const std::string large( 100, 'e' );
+
+    BOOST_CHECK( writer.write( "x", 1 ) );
+    BOOST_CHECK( writer.write( large ) );
+    BOOST_CHECK_EQUAL( writer.getWrittenSize(), 120u );
+
+    BOOST_CHECK( writer.write( "end" ) );
+    BOOST_CHECK( writer.flush() );
+    BOOST_CHECK( writer.flush() );
+    BOOST_CHECK( writer.sync() );
+    BOOST_CHECK( ! writer.getError() );
+    BOOST_CHECK_EQUAL( temporary.read(), "#!/bin/sh\necho ely\nx" + large + "end" );
+}
+
+BOOST_AUTO_TEST_CASE( vectors )
+{
+    TemporaryFile temporary;
+
+    {
+        File file( FilePath( temporary.path ), OpenMode::Write | OpenMode::Truncate );
+        BufferedWriter writer( file, 8 );
+        char first[] = "abc";
+        char second[] = "defghijkl";
+        const ::iovec small[] = { { first, 3 }, { first, 0 }, { first, 2 } };
+        const ::iovec large[] = { { first, 3 }, { second, 9 } };
+
+        BOOST_CHECK( writer.write( small, 3 ) );
+        BOOST_CHECK_EQUAL( writer.getBufferedSize(), 5u );
+        BOOST_CHECK( writer.write( large, 2 ) );
+        BOOST_CHECK_EQUAL( writer.getBufferedSize(), 0u );
+
+        // Many buffers
+        std::vector< ::iovec > many( 3000, ::iovec{ first, 1 } );
+
+        BOOST_CHECK( writer.write( many.data(), many.size() ) );
+
+        // Flushed by the destructor
+        BOOST_CHECK( writer.write( "!" ) );
+    }
+
+    BOOST_CHECK_EQUAL( temporary.read(), "abcababcdefghijkl" + std::string( 3000, 'a' ) + "!" );
+}
+
+BOOST_AUTO_TEST_CASE( errors )
+{
+    TemporaryFile temporary;
+    File readOnly( FilePath( temporary.path ), OpenMode::Read );
+    BufferedWriter writer( readOnly, 8 );
+
+    // The failure shows when the buffer is written
+    BOOST_CHECK( writer.write( "ely" ) );
+    BOOST_CHECK( ! writer.flush() );
+    BOOST_CHECK( std::errc::bad_file_descriptor == writer.getError() );
+
+    // The failure is kept
+    BOOST_CHECK( ! writer.write( "ely" ) );
+    BOOST_CHECK( ! writer.sync() );
+
+    // A full device
+    File full( FilePath( "/dev/full" ), OpenMode::Write );
+
+    if ( full.isOpen() )
+    {
+        BufferedWriter fullWriter( full, 8 );
+
+        BOOST_CHECK( ! fullWriter.write( std::string( 64, 'e' ) ) );
+        BOOST_CHECK( std::errc::no_space_on_device == fullWriter.getError() );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
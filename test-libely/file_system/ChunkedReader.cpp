@@ -0,0 +1,157 @@
+/*!
+ * \file ChunkedReader.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the ChunkedReader class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/ChunkedReader.hpp>
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using namespace ely::file_system;
+using ely::utilities::WorkStealingThreadPool;
+
+
+namespace
+{
+
+
+std::string makeRecords( std::size_t numberOfRecords, char delimiter )
+{
+    std::string content;
+
+    for ( std::size_t i = 0; i < numberOfRecords; ++i )
+    {
+        content += std::to_string( i ) + ',' + std::string( i % 53, 'v' ) + delimiter;
+    }
+
+    return content;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( chunked_reader )
+
+BOOST_AUTO_TEST_CASE( split )
+{
+    const std::string content = makeRecords( 1000, '\n' );
+    const ChunkedReader reader( content );
+
+    for ( std::size_t numberOfChunks : { 1, 2, 7, 64, 1000, 100000 } )
+    {
+        const std::vector< ChunkedReader::Chunk > chunks = reader.split( numberOfChunks );
+        std::string joined;
+
+        BOOST_CHECK( ! chunks.empty() );
+        BOOST_CHECK_LE( chunks.size(), numberOfChunks );
+
+        for ( std::size_t i = 0; i < chunks.size(); ++i )
+        {
+            BOOST_CHECK_EQUAL( chunks[ i ].index, i );
+            BOOST_CHECK_EQUAL( chunks[ i ].offset, joined.size() );
+            BOOST_CHECK( ! chunks[ i ].data.empty() );
+            BOOST_CHECK_EQUAL( chunks[ i ].data.back(), '\n' );
+            joined += chunks[ i ].data;
+        }
+
+        BOOST_CHECK( joined == content );
+    }
+
+    // A record longer than the chunks and a last record without delimiter
+    const std::string longRecord = std::string( 1000, 'x' ) + "\nend";
+    const std::vector< ChunkedReader::Chunk > chunks = ChunkedReader( longRecord ).split( 10 );
+
+    BOOST_REQUIRE_EQUAL( chunks.size(), 2u );
+    BOOST_CHECK_EQUAL( chunks[ 0 ].data.size(), 1001u );
+    BOOST_CHECK_EQUAL( chunks[ 1 ].data, "end" );
+
+    BOOST_CHECK( ChunkedReader( std::string_view() ).split( 4 ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( delimiter )
+{
+    const std::string content = makeRecords( 300, ';' );
+    const ChunkedReader reader( content, ';' );
+
+    BOOST_CHECK_EQUAL( reader.getDelimiter(), ';' );
+
+    for ( const ChunkedReader::Chunk & chunk : reader.split( 16 ) )
+    {
+        BOOST_CHECK_EQUAL( chunk.data.back(), ';' );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( ordered_merge )
+{
+    const std::string content = makeRecords( 20000, '\n' );
+    const ChunkedReader reader( content );
+    WorkStealingThreadPool pool( 4 );
+
+    // The records are merged back in their order
+    std::string merged;
+    std::size_t nextIndex = 0;
+    bool isOrdered = true;
+
+    reader.process( pool, []( const ChunkedReader::Chunk & chunk )
+    {
+        return std::make_pair( chunk.index, std::string( chunk.data ) );
+    }, [ & ]( std::pair< std::size_t, std::string > && result )
+    {
+        isOrdered = isOrdered && ( result.first == nextIndex++ );
+        merged += result.second;
+    }, 37 );
+
+    BOOST_CHECK( isOrdered );
+    BOOST_CHECK( merged == content );
+
+    // The records are counted
+    const std::vector< std::size_t > counts = reader.process( pool, []( const ChunkedReader::Chunk & chunk )
+    {
+        return static_cast< std::size_t >( std::count( chunk.data.begin(), chunk.data.end(), '\n' ) );
+    } );
+    std::size_t total = 0;
+
+    for ( std::size_t count : counts )
+    {
+        total += count;
+    }
+
+    BOOST_CHECK_EQUAL( counts.size(), 16u );
+    BOOST_CHECK_EQUAL( total, 20000u );
+}
+
+BOOST_AUTO_TEST_CASE( exception )
+{
+    const std::string content = makeRecords( 1000, '\n' );
+    const ChunkedReader reader( content );
+    WorkStealingThreadPool pool( 4 );
+    std::size_t merged = 0;
+
+    BOOST_CHECK_THROW( reader.process( pool, []( const ChunkedReader::Chunk & chunk )
+    {
+        if ( 5 == chunk.index )
+        {
+            throw std::runtime_error( "chunk" );
+        }
+
+        return chunk.index;
+    }, [ & ]( std::size_t ) { ++merged; }, 10 ), std::runtime_error );
+
+    BOOST_CHECK_EQUAL( merged, 5u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
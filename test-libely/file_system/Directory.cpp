@@ -0,0 +1,139 @@
+/*!
+ * \file Directory.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the Directory class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/Directory.hpp>
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <fstream>
+#include <set>
+#include <string>
+
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( directory )
+
+
+BOOST_AUTO_TEST_CASE( constructors )
+{
+    TemporaryDirectory temporary;
+
+    Directory directory( temporary.path );
+
+    BOOST_CHECK( directory.isOpen() );
+    BOOST_CHECK_EQUAL( directory.getError(), 0 );
+    BOOST_CHECK_EQUAL( directory.getPath(), temporary.path );
+
+    Directory moved( std::move( directory ) );
+
+    BOOST_CHECK( moved.isOpen() );
+    BOOST_CHECK( ! directory.isOpen() );
+
+    Directory missing( temporary.path + "/missing" );
+
+    BOOST_CHECK( ! missing.isOpen() );
+    BOOST_CHECK_EQUAL( missing.getError(), ENOENT );
+    BOOST_CHECK( missing.begin() == missing.end() );
+}
+
+BOOST_AUTO_TEST_CASE( entries )
+{
+    TemporaryDirectory temporary;
+
+    ::mkdir( ( temporary.path + "/sub" ).c_str(), 0700 );
+    std::ofstream( temporary.path + "/file.txt" ) << "ely";
+    ::symlink( "file.txt", ( temporary.path + "/link" ).c_str() );
+
+    Directory directory( temporary.path );
+    std::set< std::string > names;
+
+    for ( const Directory::Entry & entry : directory )
+    {
+        names.insert( std::string( entry.getName() ) );
+
+        if ( "sub" == entry.getName() )
+        {
+            BOOST_CHECK( entry.isDirectory() );
+        }
+        else if ( "file.txt" == entry.getName() )
+        {
+            BOOST_CHECK( Directory::EntryType::Regular == entry.getType() );
+        }
+        else if ( "link" == entry.getName() )
+        {
+            BOOST_CHECK( Directory::EntryType::SymbolicLink == entry.getType() );
+        }
+
+        BOOST_CHECK_NE( entry.getInode(), 0u );
+    }
+
+    BOOST_CHECK( ( std::set< std::string >{ "file.txt", "link", "sub" } ) == names );
+
+    // A second iteration restarts from the beginning
+    std::size_t count = 0;
+
+    for ( auto it = directory.begin(); it != directory.end(); ++it )
+    {
+        ++count;
+    }
+
+    BOOST_CHECK_EQUAL( count, 3u );
+
+    // Empty directory
+    Directory sub( directory, "sub" );
+
+    BOOST_CHECK( sub.isOpen() );
+    BOOST_CHECK_EQUAL( sub.getPath(), temporary.path + "/sub" );
+    BOOST_CHECK( sub.begin() == sub.end() );
+}
+
+BOOST_AUTO_TEST_CASE( batches )
+{
+    TemporaryDirectory temporary;
+    const std::size_t numberOfFiles = 2000;
+
+    for ( std::size_t i = 0; i < numberOfFiles; ++i )
+    {
+        std::ofstream( temporary.path + "/file" + std::to_string( i ) );
+    }
+
+    // A small buffer needs many getdents64 calls
+    Directory directory( temporary.path, 1024 );
+    std::set< std::string > names;
+
+    for ( const Directory::Entry & entry : directory )
+    {
+        names.insert( std::string( entry.getName() ) );
+    }
+
+    BOOST_CHECK_EQUAL( directory.getError(), 0 );
+    BOOST_CHECK_EQUAL( names.size(), numberOfFiles );
+    BOOST_CHECK_EQUAL( names.count( "file0" ), 1u );
+    BOOST_CHECK_EQUAL( names.count( "file1999" ), 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_USING_LINUX_API
@@ -0,0 +1,230 @@
+/*!
+ * \file DirectoryWalker.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the DirectoryWalker class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/DirectoryWalker.hpp>
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+using ::ely::utilities::MpmcQueue;
+using ::ely::utilities::WorkStealingThreadPool;
+
+
+namespace
+{
+
+
+/*!
+ * A temporary tree removed at the end of the test :
+ * - a.txt
+ * - b.cpp
+ * - link -> a.txt
+ * - one/c.txt
+ * - one/two/d.txt
+ * - one/two/three/e.cpp
+ * - empty/
+ */
+struct TemporaryTree : TemporaryDirectory
+{
+    TemporaryTree()
+    {
+        ::mkdir( file( "one" ).c_str(), 0700 );
+        ::mkdir( file( "one/two" ).c_str(), 0700 );
+        ::mkdir( file( "one/two/three" ).c_str(), 0700 );
+        ::mkdir( file( "empty" ).c_str(), 0700 );
+        writeFile( file( "a.txt" ), "a" );
+        writeFile( file( "b.cpp" ), "b" );
+        writeFile( file( "one/c.txt" ), "c" );
+        writeFile( file( "one/two/d.txt" ), "d" );
+        writeFile( file( "one/two/three/e.cpp" ), "e" );
+        ::symlink( "a.txt", file( "link" ).c_str() );
+    }
+};
+
+
+/// Walks through the tree and collects the paths relative to the root.
+std::set< std::string > collect( DirectoryWalker & walker, const TemporaryTree & tree )
+{
+    std::mutex mutex;
+    std::set< std::string > paths;
+
+    walker.walk( tree.path, [ & ]( const DirectoryWalker::Entry & entry )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+
+        paths.insert( std::string( entry.getPath().substr( tree.path.size() + 1 ) ) );
+    } );
+
+    return paths;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( directory_walker )
+
+BOOST_AUTO_TEST_CASE( walk )
+{
+    TemporaryTree tree;
+    WorkStealingThreadPool pool( 4 );
+    DirectoryWalker walker( pool );
+
+    BOOST_CHECK( ( std::set< std::string >{ "a.txt", "b.cpp", "link", "empty", "one", "one/c.txt", "one/two",
+                                            "one/two/d.txt", "one/two/three", "one/two/three/e.cpp" } )
+                 == collect( walker, tree ) );
+    BOOST_CHECK_EQUAL( walker.getNumberOfErrors(), 0u );
+
+    // Entries
+    std::mutex mutex;
+    bool isChecked = false;
+
+    walker.setStatusRequired( true );
+    walker.walk( tree.path, [ & ]( const DirectoryWalker::Entry & entry )
+    {
+        if ( "c.txt" == entry.getName() )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+
+            BOOST_CHECK_EQUAL( entry.getPath(), tree.path + "/one/c.txt" );
+            BOOST_CHECK( Directory::EntryType::Regular == entry.getType() );
+            BOOST_CHECK_EQUAL( entry.getDepth(), 2u );
+            BOOST_REQUIRE( nullptr != entry.getStatus() );
+            BOOST_CHECK_EQUAL( entry.getStatus()->st_size, 1 );
+            BOOST_CHECK_EQUAL( entry.getStatus()->st_ino, entry.getInode() );
+            isChecked = true;
+        }
+    } );
+
+    BOOST_CHECK( isChecked );
+
+    // Missing root
+    walker.walk( tree.path + "/missing", []( const DirectoryWalker::Entry & ) {} );
+
+    BOOST_CHECK_EQUAL( walker.getNumberOfErrors(), 1u );
+}
+
+BOOST_AUTO_TEST_CASE( filters )
+{
+    TemporaryTree tree;
+    WorkStealingThreadPool pool( 2 );
+    DirectoryWalker walker( pool );
+
+    walker.setMaximumDepth( 2 );
+
+    BOOST_CHECK_EQUAL( walker.getMaximumDepth(), 2u );
+    BOOST_CHECK( ( std::set< std::string >{ "a.txt", "b.cpp", "link", "empty", "one", "one/c.txt", "one/two" } )
+                 == collect( walker, tree ) );
+
+    walker.setMaximumDepth( std::numeric_limits< std::size_t >::max() );
+    walker.setExtensions( { "cpp" } );
+
+    BOOST_CHECK( ( std::set< std::string >{ "b.cpp", "one/two/three/e.cpp" } ) == collect( walker, tree ) );
+
+    walker.setExtensions( {} );
+    walker.setTypes( { Directory::EntryType::Directory, Directory::EntryType::SymbolicLink } );
+
+    BOOST_CHECK( ( std::set< std::string >{ "link", "empty", "one", "one/two", "one/two/three" } )
+                 == collect( walker, tree ) );
+
+    walker.setExtensions( { "txt" } );
+    walker.setTypes( { Directory::EntryType::Regular } );
+
+    BOOST_CHECK( ( std::set< std::string >{ "a.txt", "one/c.txt", "one/two/d.txt" } ) == collect( walker, tree ) );
+}
+
+BOOST_AUTO_TEST_CASE( throwing_callback )
+{
+    TemporaryTree tree;
+    WorkStealingThreadPool pool( 2 );
+    DirectoryWalker walker( pool );
+    std::mutex mutex;
+    std::set< std::string > names;
+
+    // The entries after the throwing one and the subdirectories are still walked through
+    BOOST_CHECK_THROW( walker.walk( tree.path, [ & ]( const DirectoryWalker::Entry & entry )
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+
+            names.insert( std::string( entry.getName() ) );
+        }
+
+        if ( "one" == entry.getName() || "d.txt" == entry.getName() )
+        {
+            throw std::runtime_error( std::string( entry.getName() ) );
+        }
+    } ), std::runtime_error );
+
+    BOOST_CHECK_EQUAL( names.size(), 10u );
+
+    // The walker is reusable and doesn't keep the previous callback
+    BOOST_CHECK_EQUAL( collect( walker, tree ).size(), 10u );
+}
+
+BOOST_AUTO_TEST_CASE( queue )
+{
+    TemporaryTree tree;
+    WorkStealingThreadPool pool( 2 );
+    DirectoryWalker walker( pool );
+    // Smaller than the number of entries so the walk waits for the consumer
+    MpmcQueue< Path > queue( 2 );
+    std::set< std::string > paths;
+    std::atomic< bool > isWalking( true );
+
+    std::thread consumer( [ & ]
+    {
+        Path path;
+
+        while ( isWalking || ! queue.isEmpty() )
+        {
+            if ( queue.tryPop( path ) )
+            {
+                paths.insert( std::string( path.toString() ) );
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    } );
+
+    walker.setExtensions( { "txt", "cpp" } );
+    walker.walk( tree.path, queue );
+    isWalking = false;
+    consumer.join();
+
+    BOOST_CHECK_EQUAL( paths.size(), 5u );
+    BOOST_CHECK_EQUAL( paths.count( tree.path + "/one/two/three/e.cpp" ), 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_USING_LINUX_API
@@ -0,0 +1,201 @@
+/*!
+ * \file File.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the File class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+#include <unistd.h>
+
+
+#include <ely/file_system/AlignedBuffer.hpp>
+#include <ely/file_system/File.hpp>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( file )
+
+BOOST_AUTO_TEST_CASE( open_modes )
+{
+    TemporaryDirectory directory;
+
+    // Reading doesn't create the file
+    File missing( directory.file( "missing" ), OpenMode::Read );
+
+    BOOST_CHECK( ! missing.isOpen() );
+    BOOST_CHECK_EQUAL( missing.getError(), ENOENT );
+    BOOST_CHECK( ! missing );
+
+    // Creation
+    File created( directory.file( "file" ), OpenMode::Write | OpenMode::Create );
+
+    BOOST_REQUIRE( created.isOpen() );
+    BOOST_CHECK( OpenMode::Write == ( created.getOpenMode() & OpenMode::Write ) );
+    BOOST_CHECK( created.write( "0123456789", 10 ) );
+    created.close();
+
+    // Exclusive creation
+    File exclusive( directory.file( "file" ), OpenMode::Write | OpenMode::Exclusive );
+
+    BOOST_CHECK( ! exclusive.isOpen() );
+    BOOST_CHECK_EQUAL( exclusive.getError(), EEXIST );
+
+    // Writing without truncating
+    File overwritten( directory.file( "file" ), OpenMode::Write );
+
+    BOOST_CHECK( overwritten.write( "ab", 2 ) );
+    overwritten.close();
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "ab23456789" );
+
+    char buffer[ 16 ];
+
+    // Appending
+    File appended( directory.file( "file" ), OpenMode::Write | OpenMode::Append );
+
+    BOOST_CHECK( appended.write( "cd", 2 ) );
+    appended.close();
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "ab23456789cd" );
+
+    // Appending gives write access
+    File appendedOnly( directory.file( "file" ), OpenMode::Append );
+
+    BOOST_CHECK( appendedOnly.write( "ef", 2 ) );
+    BOOST_CHECK_EQUAL( appendedOnly.getError(), 0 );
+    appendedOnly.close();
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "ab23456789cdef" );
+
+    File readAppended( directory.file( "file" ), OpenMode::Read | OpenMode::Append );
+
+    BOOST_CHECK( readAppended.write( "g", 1 ) );
+    BOOST_CHECK_EQUAL( readAppended.readAt( 12, buffer, 3 ), 3u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 3 ), "efg" );
+    readAppended.close();
+
+    // Truncating
+    File truncated( directory.file( "file" ), OpenMode::Write | OpenMode::Truncate );
+
+    BOOST_CHECK_EQUAL( truncated.getSize(), 0u );
+    BOOST_CHECK( truncated.write( "ely", 3 ) );
+
+    // Reading only
+    File read( directory.file( "file" ), OpenMode::Read );
+
+    BOOST_CHECK_EQUAL( read.read( buffer, sizeof( buffer ) ), 3u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 3 ), "ely" );
+    BOOST_CHECK( ! read.write( "x", 1 ) );
+    BOOST_CHECK_EQUAL( read.getError(), EBADF );
+
+    // Reopening with another mode
+    BOOST_CHECK( read.open( directory.file( "file" ), OpenMode::ReadWrite ) );
+    BOOST_CHECK( read.write( "E", 1 ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "Ely" );
+}
+
+BOOST_AUTO_TEST_CASE( positioned_io )
+{
+    TemporaryDirectory directory;
+    File file( directory.file( "file" ), OpenMode::ReadWrite | OpenMode::Create );
+
+    BOOST_CHECK( file.writeAt( 4, "ely", 3 ) );
+    BOOST_CHECK_EQUAL( file.getSize(), 7u );
+
+    char buffer[ 8 ] = {};
+
+    BOOST_CHECK_EQUAL( file.readAt( 4, buffer, sizeof( buffer ) ), 3u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 3 ), "ely" );
+    BOOST_CHECK_EQUAL( file.readAt( 100, buffer, sizeof( buffer ) ), 0u );
+    BOOST_CHECK_EQUAL( file.getError(), 0 );
+
+    // The current position didn't move
+    BOOST_CHECK( file.write( "abcd", 4 ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "abcdely" );
+    BOOST_CHECK( file.sync() );
+}
+
+BOOST_AUTO_TEST_CASE( direct_io )
+{
+    TemporaryDirectory directory;
+    AlignedBuffer buffer( 10000 );
+
+    BOOST_CHECK_EQUAL( buffer.getSize(), 12288u );
+    BOOST_CHECK_EQUAL( buffer.getAlignment(), AlignedBuffer::defaultAlignment() );
+    BOOST_CHECK_EQUAL( reinterpret_cast< std::uintptr_t >( buffer.getData() ) % buffer.getAlignment(), 0u );
+
+    File file( directory.file( "direct" ), OpenMode::ReadWrite | OpenMode::Create | OpenMode::Direct );
+
+    // Some file systems, as tmpfs, don't support direct transfers
+    if ( ! file.isOpen() && EINVAL == file.getError() )
+    {
+        return;
+    }
+
+    BOOST_REQUIRE( file.isOpen() );
+
+    std::memset( buffer.getData(), 'e', buffer.getSize() );
+    BOOST_CHECK( file.writeAt( 0, buffer.getData(), buffer.getSize() ) );
+
+    AlignedBuffer read( 4096 );
+
+    BOOST_CHECK_EQUAL( file.readAt( 8192, read.getData(), read.getSize() ), 4096u );
+    BOOST_CHECK( std::byte( 'e' ) == read.getData()[ 4095 ] );
+
+    AlignedBuffer moved( std::move( read ) );
+
+    BOOST_CHECK( nullptr == read.getData() );
+    BOOST_CHECK_EQUAL( moved.getSize(), 4096u );
+}
+
+BOOST_AUTO_TEST_CASE( stream )
+{
+    TemporaryDirectory directory;
+    File file( directory.file( "file" ) );
+
+    BOOST_REQUIRE( file.isOpen() );
+    BOOST_CHECK( File::defaultOpenMode() == file.getOpenMode() );
+
+    // The pending writes of the stream come before the direct writes
+    file << "ely " << 42;
+    BOOST_CHECK( file.write( " !", 2 ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "file" ) ), "ely 42 !" );
+
+    file << " end";
+    BOOST_CHECK_EQUAL( file.getSize(), 12u );
+
+    std::string word;
+    int number = 0;
+
+    file.getStream().seekg( 0 );
+    file >> word >> number;
+
+    BOOST_CHECK_EQUAL( word, "ely" );
+    BOOST_CHECK_EQUAL( number, 42 );
+
+    // The direct reads continue after the data extracted from the stream
+    char rest[ 3 ] = {};
+
+    BOOST_CHECK_EQUAL( file.read( rest, sizeof( rest ) ), sizeof( rest ) );
+    BOOST_CHECK_EQUAL( std::string( rest, sizeof( rest ) ), " ! " );
+
+    file >> word;
+    BOOST_CHECK_EQUAL( word, "end" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
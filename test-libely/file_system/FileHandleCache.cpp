@@ -0,0 +1,217 @@
+/*!
+ * \file FileHandleCache.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the FileHandleCache class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/FileHandleCache.hpp>
+
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+/// Creates the files named from 0 to \p numberOfFiles - 1 in \p directory .
+void createFiles( const TemporaryDirectory & directory, int numberOfFiles )
+{
+    for ( int i = 0; i < numberOfFiles; ++i )
+    {
+        writeFile( directory.file( std::to_string( i ) ), "file " + std::to_string( i ) );
+    }
+}
+
+FilePath numberedFile( const TemporaryDirectory & directory, int index )
+{
+    return FilePath( directory.file( std::to_string( index ) ) );
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( file_handle_cache )
+
+BOOST_AUTO_TEST_CASE( eviction )
+{
+    TemporaryDirectory directory;
+
+    createFiles( directory, 10 );
+    FileHandleCache cache( 4 );
+
+    BOOST_CHECK_EQUAL( cache.getCapacity(), 4u );
+
+    const FileHandleCache::Handle first = cache.acquire( numberedFile( directory, 0 ) );
+
+    BOOST_REQUIRE( first->isOpen() );
+    BOOST_CHECK( cache.acquire( numberedFile( directory, 0 ) ) == first );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits(), 1u );
+    BOOST_CHECK_EQUAL( cache.getNumberOfMisses(), 1u );
+
+    // The least recently used files are closed
+    std::weak_ptr< File > second = cache.acquire( numberedFile( directory, 1 ) );
+
+    for ( int i = 2; i < 10; ++i )
+    {
+        cache.acquire( numberedFile( directory, i ) );
+    }
+
+    BOOST_CHECK_EQUAL( cache.getSize(), 4u );
+    BOOST_CHECK( second.expired() );
+
+    // An evicted file stays open while its handle is held, and is reopened
+    BOOST_CHECK( first->isOpen() );
+    BOOST_CHECK( cache.acquire( numberedFile( directory, 0 ) ) != first );
+
+    // The most recently used files are kept
+    const std::uint64_t misses = cache.getNumberOfMisses();
+
+    cache.acquire( numberedFile( directory, 9 ) );
+    cache.acquire( numberedFile( directory, 8 ) );
+    BOOST_CHECK_EQUAL( cache.getNumberOfMisses(), misses );
+
+    cache.erase( numberedFile( directory, 9 ) );
+    BOOST_CHECK_EQUAL( cache.getSize(), 3u );
+    cache.clear();
+    BOOST_CHECK_EQUAL( cache.getSize(), 0u );
+
+    // A missing file is not kept
+    const FileHandleCache::Handle missing = cache.acquire( FilePath( directory.path + "/missing" ) );
+
+    BOOST_CHECK( ! missing->isOpen() );
+    BOOST_CHECK_EQUAL( missing->getError(), ENOENT );
+    BOOST_CHECK_EQUAL( cache.getSize(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( paths_of_a_file )
+{
+    TemporaryDirectory directory;
+
+    createFiles( directory, 1 );
+    FileHandleCache cache( 4 );
+
+    const FileHandleCache::Handle file = cache.acquire( numberedFile( directory, 0 ) );
+
+    BOOST_REQUIRE( file->isOpen() );
+
+    // The same path
+    BOOST_CHECK( cache.acquire( FilePath( directory.path + "/./0" ) ) == file );
+    BOOST_CHECK( cache.acquire( FilePath( directory.path + "//0" ) ) == file );
+    BOOST_CHECK_EQUAL( cache.getNumberOfMisses(), 1u );
+
+    // Other paths of the same file
+    ::link( directory.file( "0" ).c_str(), directory.file( "hard" ).c_str() );
+    ::symlink( directory.file( "0" ).c_str(), directory.file( "symbolic" ).c_str() );
+    BOOST_CHECK( cache.acquire( FilePath( directory.file( "hard" ) ) ) == file );
+    BOOST_CHECK( cache.acquire( FilePath( directory.file( "symbolic" ) ) ) == file );
+    BOOST_CHECK_EQUAL( cache.getSize(), 1u );
+
+    // Removed with its other paths
+    cache.erase( FilePath( directory.path + "/./0" ) );
+    BOOST_CHECK_EQUAL( cache.getSize(), 0u );
+    BOOST_CHECK( cache.acquire( FilePath( directory.file( "hard" ) ) ) != file );
+}
+
+BOOST_AUTO_TEST_CASE( parent_through_link )
+{
+    TemporaryDirectory directory;
+    FileHandleCache cache( 4 );
+    std::error_code error;
+    char buffer[ 8 ] = {};
+
+    // link/.. is the parent of the target of the link, not the directory of the link
+    ::mkdir( directory.file( "sub" ).c_str(), 0755 );
+    ::mkdir( directory.file( "sub/inner" ).c_str(), 0755 );
+    ::symlink( directory.file( "sub/inner" ).c_str(), directory.file( "link" ).c_str() );
+    writeFile( directory.file( "data" ), "top" );
+    writeFile( directory.file( "sub/data" ), "sub" );
+
+    BOOST_CHECK_EQUAL( cache.readAt( FilePath( directory.file( "data" ) ), 0, buffer, 3, error ), 3u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 3 ), "top" );
+    BOOST_CHECK_EQUAL( cache.readAt( FilePath( directory.file( "link/../data" ) ), 0, buffer, 3, error ), 3u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 3 ), "sub" );
+    BOOST_CHECK_EQUAL( cache.getSize(), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( read_write )
+{
+    TemporaryDirectory directory;
+
+    createFiles( directory, 4 );
+    FileHandleCache cache( 2, OpenMode::ReadWrite );
+    std::error_code error;
+    char buffer[ 16 ] = {};
+
+    BOOST_CHECK_EQUAL( cache.readAt( numberedFile( directory, 3 ), 5, buffer, sizeof( buffer ), error ), 1u );
+    BOOST_CHECK( ! error );
+    BOOST_CHECK_EQUAL( buffer[ 0 ], '3' );
+
+    BOOST_CHECK( cache.writeAt( numberedFile( directory, 3 ), 0, "FILE", 4, error ) );
+    BOOST_CHECK_EQUAL( cache.readAt( numberedFile( directory, 3 ), 0, buffer, 6, error ), 6u );
+    BOOST_CHECK_EQUAL( std::string( buffer, 6 ), "FILE 3" );
+
+    BOOST_CHECK_EQUAL( cache.readAt( FilePath( directory.path + "/missing" ), 0, buffer, 1, error ), 0u );
+    BOOST_CHECK_EQUAL( error.value(), ENOENT );
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_access )
+{
+    const int numberOfFiles = 64;
+    TemporaryDirectory directory;
+
+    createFiles( directory, numberOfFiles );
+    FileHandleCache cache( 8 );
+    std::atomic< int > failures( 0 );
+    std::vector< std::thread > threads;
+
+    for ( int t = 0; t < 8; ++t )
+    {
+        threads.emplace_back( [ &, t ]
+        {
+            for ( int i = 0; i < 2000; ++i )
+            {
+                const int index = ( i * 7 + t ) % numberOfFiles;
+                const std::string expected = "file " + std::to_string( index );
+                char buffer[ 16 ];
+                std::error_code error;
+                const std::size_t size = cache.readAt( numberedFile( directory, index ), 0, buffer, sizeof( buffer ), error );
+
+                failures += error || ( std::string( buffer, size ) != expected );
+            }
+        } );
+    }
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL( failures, 0 );
+    BOOST_CHECK_LE( cache.getSize(), 8u );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits() + cache.getNumberOfMisses(), 16000u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
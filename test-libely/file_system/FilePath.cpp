@@ -165,6 +165,22 @@ BOOST_AUTO_TEST_CASE( other_functions )
     FilePath filePath( systemFilePath );
 
     BOOST_CHECK_EQUAL( filePath.toString(), standardFilePath );
+
+    // The extension is kept when renaming the file
+    filePath.setName( "new script" );
+
+    BOOST_CHECK_EQUAL( filePath.getName(), "new script." + extension );
+    BOOST_CHECK_EQUAL( filePath.getExtension(), extension );
+
+    // Even through a reference on the base class
+    Path & path = filePath;
+
+    path.setName( "other script" );
+
+    BOOST_CHECK_EQUAL( filePath.getName(), "other script." + extension );
+    BOOST_CHECK_EQUAL( filePath.getExtension(), extension );
+
+    BOOST_CHECK_EQUAL( ::std::hash< FilePath >()( filePath ), ::std::hash< Path >()( Path( string( filePath.toString() ) ) ) );
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,234 @@
+/*!
+ * \file FileWatcher.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the FileWatcher class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/FileWatcher.hpp>
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include <ely/signals_slots/Slot.hpp>
+#include <ely/signals_slots/connect.hpp>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+using ::ely::signals_slots::Slot;
+using ::ely::signals_slots::connect;
+
+
+namespace
+{
+
+
+/// Records the events emitted by a watcher.
+struct Recorder
+{
+    explicit Recorder( FileWatcher & watcher )
+    {
+        slot.bind( [ this ]( const Path & path, FileWatcher::Event event )
+        {
+            events.emplace_back( std::string( path.getName() ), event );
+        } );
+        connect( watcher.changed, slot );
+    }
+
+    bool contains( const std::string & name, FileWatcher::Event event ) const
+    {
+        return events.end() != std::find( events.begin(), events.end(), std::make_pair( name, event ) );
+    }
+
+
+    std::vector< std::pair< std::string, FileWatcher::Event > > events;
+    Slot< const Path &, FileWatcher::Event > slot;
+};
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( file_watcher )
+
+BOOST_AUTO_TEST_CASE( directory_events )
+{
+    TemporaryDirectory directory;
+    FileWatcher watcher;
+    Recorder recorder( watcher );
+
+    BOOST_REQUIRE( watcher.isValid() );
+    BOOST_REQUIRE( watcher.watch( Path( directory.path ) ) );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 1u );
+    BOOST_CHECK_EQUAL( watcher.poll(), 0u );
+
+    appendFile( directory.file( "file" ), "content" );
+    std::rename( directory.file( "file" ).c_str(), directory.file( "renamed" ).c_str() );
+    std::remove( directory.file( "renamed" ).c_str() );
+
+    BOOST_CHECK_GE( watcher.wait( 1000 ), 5u );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Created ) );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Modified ) );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::MovedFrom ) );
+    BOOST_CHECK( recorder.contains( "renamed", FileWatcher::Event::MovedTo ) );
+    BOOST_CHECK( recorder.contains( "renamed", FileWatcher::Event::Deleted ) );
+
+    // In the order of the changes
+    BOOST_CHECK( FileWatcher::Event::Created == recorder.events.front().second );
+    BOOST_CHECK( FileWatcher::Event::Deleted == recorder.events.back().second );
+
+    // No more event
+    BOOST_CHECK_EQUAL( watcher.wait( 0 ), 0u );
+
+    BOOST_CHECK( watcher.unwatch( Path( directory.path ) ) );
+    BOOST_CHECK( ! watcher.unwatch( Path( directory.path ) ) );
+    appendFile( directory.file( "other" ), "content" );
+    BOOST_CHECK_EQUAL( watcher.poll(), 0u );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( file_events )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    FileWatcher watcher;
+    Recorder recorder( watcher );
+
+    appendFile( path, "content" );
+    BOOST_REQUIRE( watcher.watch( Path( path ) ) );
+
+    // The events of a file have its own path
+    ::chmod( path.c_str(), 0600 );
+    std::remove( path.c_str() );
+
+    watcher.wait( 1000 );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Modified ) );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Deleted ) );
+
+    // Not watched anymore once removed
+    watcher.poll();
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 0u );
+
+    BOOST_CHECK( ! watcher.watch( Path( directory.file( "missing" ) ) ) );
+    BOOST_CHECK_EQUAL( watcher.getError().value(), ENOENT );
+}
+
+BOOST_AUTO_TEST_CASE( watched_again )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    FileWatcher watcher;
+    Recorder recorder( watcher );
+    Slot< const Path &, FileWatcher::Event > rewatch;
+
+    appendFile( path, "content" );
+    BOOST_REQUIRE( watcher.watch( Path( path ) ) );
+
+    // Created and watched again before the former watch is removed
+    rewatch.bind( [ & ]( const Path &, FileWatcher::Event event )
+    {
+        if ( FileWatcher::Event::Deleted == event )
+        {
+            appendFile( path, "new" );
+            watcher.watch( Path( path ) );
+        }
+    } );
+    connect( watcher.changed, rewatch );
+
+    std::remove( path.c_str() );
+    watcher.wait( 1000 );
+    watcher.poll();
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Deleted ) );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 1u );
+
+    recorder.events.clear();
+    appendFile( path, "1" );
+    watcher.wait( 1000 );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Modified ) );
+}
+
+BOOST_AUTO_TEST_CASE( aliases )
+{
+    TemporaryDirectory directory;
+    const std::string watched = directory.file( "watched" );
+    const std::string link = directory.file( "link" );
+    FileWatcher watcher;
+    Recorder recorder( watcher );
+
+    ::mkdir( watched.c_str(), 0755 );
+    ::symlink( watched.c_str(), link.c_str() );
+
+    // Two paths of the same directory
+    BOOST_REQUIRE( watcher.watch( Path( watched ) ) );
+    BOOST_REQUIRE( watcher.watch( Path( link ) ) );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 2u );
+
+    appendFile( watched + "/file", "1" );
+    watcher.wait( 1000 );
+    BOOST_CHECK_EQUAL( std::count( recorder.events.begin(), recorder.events.end(),
+                                   std::make_pair( std::string( "file" ), FileWatcher::Event::Created ) ), 1 );
+
+    // Still watched through the other path
+    BOOST_CHECK( watcher.unwatch( Path( watched ) ) );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 1u );
+
+    recorder.events.clear();
+    appendFile( watched + "/file", "2" );
+    watcher.wait( 1000 );
+    BOOST_CHECK( recorder.contains( "file", FileWatcher::Event::Modified ) );
+
+    BOOST_CHECK( watcher.unwatch( Path( link ) ) );
+    BOOST_CHECK_EQUAL( watcher.getNumberOfWatches(), 0u );
+    appendFile( watched + "/file", "3" );
+    BOOST_CHECK_EQUAL( watcher.poll(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( batches )
+{
+    TemporaryDirectory directory;
+    // Room for a few events by reading
+    FileWatcher watcher( 0 );
+    Recorder recorder( watcher );
+
+    BOOST_REQUIRE( watcher.watch( Path( directory.path ) ) );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        ::close( ::creat( directory.file( std::to_string( i ) ).c_str(), 0644 ) );
+    }
+
+    BOOST_CHECK_EQUAL( watcher.poll(), 100u );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        BOOST_CHECK( std::make_pair( std::to_string( i ), FileWatcher::Event::Created ) == recorder.events[ i ] );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_USING_LINUX_API
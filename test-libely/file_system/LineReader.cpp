@@ -0,0 +1,144 @@
+/*!
+ * \file LineReader.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the LineReader class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/LineReader.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+std::vector< std::string > readLines( LineReader & reader )
+{
+    std::vector< std::string > lines;
+
+    for ( std::string_view line : reader )
+    {
+        lines.emplace_back( line );
+    }
+
+    return lines;
+}
+
+
+std::vector< std::string > expectedLines( const std::string & content )
+{
+    std::vector< std::string > lines;
+    std::istringstream stream( content );
+    std::string line;
+
+    while ( std::getline( stream, line ) )
+    {
+        lines.push_back( line );
+    }
+
+    return lines;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( line_reader )
+
+BOOST_AUTO_TEST_CASE( content )
+{
+    LineReader reader( std::string_view( "first\n\nthird\r\nlast" ) );
+    std::string_view line;
+
+    BOOST_CHECK( reader.next( line ) );
+    BOOST_CHECK_EQUAL( line, "first" );
+    BOOST_CHECK( reader.next( line ) );
+    BOOST_CHECK( line.empty() );
+    BOOST_CHECK( reader.next( line ) );
+    BOOST_CHECK_EQUAL( line, "third\r" );
+    BOOST_CHECK( reader.next( line ) );
+    BOOST_CHECK_EQUAL( line, "last" );
+    BOOST_CHECK( ! reader.next( line ) );
+    BOOST_CHECK_EQUAL( reader.getLineNumber(), 4u );
+
+    LineReader empty( std::string_view( "" ) );
+
+    BOOST_CHECK( empty.begin() == empty.end() );
+
+    LineReader newLine( std::string_view( "\n" ) );
+
+    BOOST_CHECK_EQUAL( readLines( newLine ).size(), 1u );
+}
+
+BOOST_AUTO_TEST_CASE( small_buffer )
+{
+    std::string content;
+
+    for ( int i = 0; i < 500; ++i )
+    {
+        content += std::string( static_cast< std::size_t >( i % 37 ), static_cast< char >( 'a' + i % 26 ) ) + '\n';
+    }
+
+    // Lines longer than the buffer and without final line feed
+    content += std::string( 100, 'x' ) + "\n" + std::string( 70, 'y' );
+
+    TemporaryFile temporary( content );
+
+    for ( std::size_t bufferSize : { 1, 7, 16, 64, 4096 } )
+    {
+        File file( FilePath( temporary.path ), OpenMode::Read );
+        LineReader reader( file, bufferSize );
+
+        BOOST_CHECK( readLines( reader ) == expectedLines( content ) );
+        BOOST_CHECK_EQUAL( reader.getLineNumber(), 502u );
+        BOOST_CHECK_EQUAL( reader.getError(), 0 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( mapped_file )
+{
+    std::string content;
+
+    for ( int i = 0; i < 10000; ++i )
+    {
+        content += "line " + std::to_string( i ) + '\n';
+    }
+
+    TemporaryFile temporary( content );
+    MappedFile mappedFile( FilePath( temporary.path ) );
+    LineReader reader( mappedFile );
+    const std::vector< std::string > lines = readLines( reader );
+
+    BOOST_CHECK( lines == expectedLines( content ) );
+    BOOST_CHECK_EQUAL( lines.back(), "line 9999" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,122 @@
+/*!
+ * \file MappedFile.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the MappedFile class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/MappedFile.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( mapped_file )
+
+BOOST_AUTO_TEST_CASE( map )
+{
+    TemporaryFile temporary( "#!/bin/sh\necho ely\n" );
+    MappedFile file( FilePath( temporary.path ) );
+
+    BOOST_REQUIRE( file.isMapped() );
+    BOOST_CHECK_EQUAL( file.getError(), 0 );
+    BOOST_CHECK_EQUAL( file.getPath().toString(), temporary.path );
+    BOOST_CHECK_EQUAL( file.getSize(), 19u );
+    BOOST_CHECK( ! file.isEmpty() );
+    BOOST_CHECK_EQUAL( file.getContent(), "#!/bin/sh\necho ely\n" );
+    BOOST_CHECK( std::byte( '#' ) == file.getData()[ 0 ] );
+
+    // Move
+    MappedFile moved( std::move( file ) );
+
+    BOOST_CHECK( moved.isMapped() );
+    BOOST_CHECK_EQUAL( moved.getContent(), "#!/bin/sh\necho ely\n" );
+    BOOST_CHECK( ! file.isMapped() );
+    BOOST_CHECK( file.getContent().empty() );
+
+    moved.unmap();
+
+    BOOST_CHECK( ! moved.isMapped() );
+    BOOST_CHECK( moved.isEmpty() );
+    BOOST_CHECK( moved.map() );
+    BOOST_CHECK_EQUAL( moved.getSize(), 19u );
+}
+
+BOOST_AUTO_TEST_CASE( empty_and_missing_files )
+{
+    TemporaryFile temporary( "" );
+    MappedFile empty( FilePath( temporary.path ) );
+
+    BOOST_CHECK( empty.isMapped() );
+    BOOST_CHECK( empty.isEmpty() );
+    BOOST_CHECK( nullptr == empty.getData() );
+    BOOST_CHECK( empty.getContent().empty() );
+    BOOST_CHECK( empty.advise( MappedFile::Advice::Sequential ) );
+
+    MappedFile missing( FilePath( temporary.path + ".missing" ) );
+
+    BOOST_CHECK( ! missing.isMapped() );
+    BOOST_CHECK_EQUAL( missing.getError(), ENOENT );
+    BOOST_CHECK( ! missing.advise( MappedFile::Advice::Random ) );
+}
+
+BOOST_AUTO_TEST_CASE( advise )
+{
+    TemporaryFile temporary( std::string( 3 * 4096 + 10, 'e' ) );
+    MappedFile file( FilePath( temporary.path ) );
+
+    BOOST_CHECK( file.advise( MappedFile::Advice::Sequential ) );
+    BOOST_CHECK( file.advise( MappedFile::Advice::WillNeed, 5000, 100 ) );
+    BOOST_CHECK( file.advise( MappedFile::Advice::Random, 4096, std::string::npos ) );
+    BOOST_CHECK( file.advise( MappedFile::Advice::Normal, file.getSize() + 1, 1 ) );
+    BOOST_CHECK_EQUAL( file.getContent().back(), 'e' );
+}
+
+BOOST_AUTO_TEST_CASE( huge_file )
+{
+    // A sparse file larger than 4 GiB
+    const off_t size = ( off_t( 5 ) << 30 ) + 1;
+    TemporaryFile temporary( "" );
+
+    BOOST_REQUIRE_EQUAL( ::truncate( temporary.path.c_str(), size - 1 ), 0 );
+
+    const int descriptor = ::open( temporary.path.c_str(), O_WRONLY );
+
+    BOOST_REQUIRE_EQUAL( ::pwrite( descriptor, "x", 1, size - 1 ), 1 );
+    ::close( descriptor );
+
+    MappedFile file( FilePath( temporary.path ) );
+
+    BOOST_REQUIRE( file.isMapped() );
+    BOOST_CHECK_EQUAL( file.getSize(), static_cast< std::size_t >( size ) );
+    BOOST_CHECK( file.advise( MappedFile::Advice::Random ) );
+    BOOST_CHECK_EQUAL( file.getContent()[ file.getSize() - 1 ], 'x' );
+    BOOST_CHECK_EQUAL( file.getContent()[ file.getSize() / 2 ], '\0' );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <sstream>
+#include <unordered_set>
 
 #include <ely/config.hpp>
 #include <ely/file_system/Path.hpp>
@@ -298,6 +299,25 @@ BOOST_AUTO_TEST_CASE( other_functions )
 
     BOOST_CHECK_EQUAL( rootPath.toString(), "/" );
 
+    Path rootChildPath( "/file.sh" );
+
+    BOOST_CHECK_EQUAL( rootChildPath.toString(), "/file.sh" );
+    BOOST_CHECK_EQUAL( rootChildPath.getAccessPath(), "/" );
+    BOOST_CHECK_EQUAL( rootChildPath.getName(), "file.sh" );
+
+    Path relativePath( "file.sh" );
+
+    BOOST_CHECK_EQUAL( relativePath.toString(), "./file.sh" );
+
+    Path sameNamesPath( "ely/ely" );
+
+    BOOST_CHECK_EQUAL( sameNamesPath.toString(), "ely/ely" );
+
+    rootChildPath.setAccessPath( "/home/" );
+    rootChildPath.setName( "ely" );
+
+    BOOST_CHECK_EQUAL( rootChildPath.toString(), "/home/ely" );
+
 
     stringstream ss;
     path.print( ss );
@@ -331,5 +351,65 @@ BOOST_AUTO_TEST_CASE( other_operators )
     BOOST_CHECK_NE( firstPath, thirdPath );
 }
 
+BOOST_AUTO_TEST_CASE( hash )
+{
+    const Path path( systemFilePath );
+    Path copyPath( path );
+
+    BOOST_CHECK_EQUAL( path.getHash(), copyPath.getHash() );
+    BOOST_CHECK_EQUAL( path.getHash(), Path( standardFilePath ).getHash() );
+
+    copyPath.setName( "other name" );
+
+    BOOST_CHECK_NE( path.getHash(), copyPath.getHash() );
+    BOOST_CHECK_NE( path, copyPath );
+
+    copyPath.setName( pathName );
+
+    BOOST_CHECK_EQUAL( path.getHash(), copyPath.getHash() );
+    BOOST_CHECK_EQUAL( path, copyPath );
+
+    // The moved path is left empty with the hash of an empty path
+    Path movedPath( std::move( copyPath ) );
+
+    BOOST_CHECK_EQUAL( copyPath.getHash(), Path( "" ).getHash() );
+
+    ::std::unordered_set< Path > paths { path, Path( "/usr/bin/gcc" ), Path( "/usr/bin/gcc/" ) };
+
+    BOOST_CHECK_EQUAL( paths.size(), 2u );
+    BOOST_CHECK_EQUAL( paths.count( movedPath ), 1u );
+}
+
+BOOST_AUTO_TEST_CASE( join )
+{
+    const Path home( "/home/ely" );
+
+    BOOST_CHECK_EQUAL( ( home + "script.sh" ).toString(), "/home/ely/script.sh" );
+    BOOST_CHECK_EQUAL( ( home + string( "directory/" ) ).toString(), "/home/ely/directory" );
+    BOOST_CHECK_EQUAL( ( home + Path( "directory/script.sh" ) ).toString(), "/home/ely/directory/script.sh" );
+    BOOST_CHECK_EQUAL( ( home + "/usr/bin" ).toString(), "/usr/bin" );
+    BOOST_CHECK_EQUAL( ( home + "" ).toString(), "/home/ely" );
+    BOOST_CHECK_EQUAL( ( Path( "/" ) + "file.sh" ).toString(), "/file.sh" );
+
+    const Path joined = Path::join( "/", "home/", string( "ely" ), home + "..", "", "script.sh" );
+
+    BOOST_CHECK_EQUAL( joined.toString(), "/home/ely/../script.sh" );
+    BOOST_CHECK_EQUAL( joined.getAccessPath(), "/home/ely/.." );
+    BOOST_CHECK_EQUAL( joined.getName(), "script.sh" );
+    BOOST_CHECK_EQUAL( Path::join( "relative", "script.sh" ).toString(), "relative/script.sh" );
+    BOOST_CHECK_EQUAL( Path::join( "script.sh" ).toString(), "./script.sh" );
+    BOOST_CHECK_EQUAL( Path::join().toString(), "" );
+
+    // The buffer is reused
+    string buffer;
+
+    buffer.reserve( 64 );
+
+    const char * data = buffer.data();
+
+    BOOST_CHECK_EQUAL( Path::joinTo( buffer, home, "script.sh" ), "/home/ely/script.sh" );
+    BOOST_CHECK( data == buffer.data() );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/*!
+ * \file PathTable.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the PathTable class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include <ely/file_system/PathTable.hpp>
+
+
+using ::std::string;
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( path_table )
+
+BOOST_AUTO_TEST_CASE( intern )
+{
+    PathTable table;
+
+    BOOST_CHECK_EQUAL( table.getSize(), 1u );
+    BOOST_CHECK_EQUAL( table.intern( "" ), PathTable::emptyPathId() );
+
+    const PathTable::Id script = table.intern( "/home/ely/script.sh" );
+    const PathTable::Id other = table.intern( "/home/ely/other.sh" );
+
+    // The directories are shared
+    BOOST_CHECK_EQUAL( table.getSize(), 6u );
+    BOOST_CHECK_NE( script, other );
+    BOOST_CHECK_EQUAL( table.getParent( script ), table.getParent( other ) );
+    BOOST_CHECK_EQUAL( table.intern( "/home/ely/script.sh" ), script );
+    BOOST_CHECK_EQUAL( table.intern( "/home//ely/script.sh/" ), script );
+
+    BOOST_CHECK_EQUAL( table.getName( script ), "script.sh" );
+    BOOST_CHECK_EQUAL( table.getName( table.getParent( script ) ), "ely" );
+    BOOST_CHECK_EQUAL( table.find( "/home/ely" ), table.getParent( script ) );
+    BOOST_CHECK_EQUAL( table.find( "/home/ely/missing.sh" ), PathTable::invalidId() );
+    BOOST_CHECK_EQUAL( table.find( "home/ely" ), PathTable::invalidId() );
+}
+
+BOOST_AUTO_TEST_CASE( conversions )
+{
+    PathTable table;
+
+    BOOST_CHECK_EQUAL( table.toString( table.intern( "/" ) ), "/" );
+    BOOST_CHECK_EQUAL( table.toString( table.intern( "/file.sh" ) ), "/file.sh" );
+    BOOST_CHECK_EQUAL( table.toString( table.intern( "/home/ely/script.sh" ) ), "/home/ely/script.sh" );
+    BOOST_CHECK_EQUAL( table.toString( table.intern( "./relative/path" ) ), "./relative/path" );
+    BOOST_CHECK_EQUAL( table.toString( table.intern( "relative" ) ), "relative" );
+    BOOST_CHECK_EQUAL( table.toString( PathTable::emptyPathId() ), "" );
+
+    string pathString( "prefix:" );
+
+    table.appendTo( table.find( "/home/ely" ), pathString );
+
+    BOOST_CHECK_EQUAL( pathString, "prefix:/home/ely" );
+
+    const Path path = table.toPath( table.find( "/home/ely/script.sh" ) );
+
+    BOOST_CHECK_EQUAL( path.getAccessPath(), "/home/ely" );
+    BOOST_CHECK_EQUAL( path.getName(), "script.sh" );
+}
+
+BOOST_AUTO_TEST_CASE( growth )
+{
+    PathTable table;
+    const unsigned int count = 5000;
+
+    for ( unsigned int i = 0; i < count; ++i )
+    {
+        table.intern( "/data/" + ::std::to_string( i % 50 ) + "/file" + ::std::to_string( i ) );
+    }
+
+    BOOST_CHECK_EQUAL( table.getSize(), 1u + 2u + 50u + count );
+
+    bool isFound = true;
+
+    for ( unsigned int i = 0; i < count; ++i )
+    {
+        const string pathString = "/data/" + ::std::to_string( i % 50 ) + "/file" + ::std::to_string( i );
+
+        isFound = isFound && ( table.toString( table.find( pathString ) ) == pathString );
+    }
+
+    BOOST_CHECK( isFound );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
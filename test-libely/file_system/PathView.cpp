@@ -0,0 +1,81 @@
+/*!
+ * \file PathView.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the PathView class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ely/config.hpp>
+#include <ely/file_system/FilePath.hpp>
+#include <ely/file_system/PathView.hpp>
+
+
+using ::std::string;
+using ::std::string_view;
+using ::std::vector;
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( path_view )
+
+BOOST_AUTO_TEST_CASE( same_semantics_as_path )
+{
+    const vector< string > paths {
+        "", "/", ".", "./", "..", "../", "file.sh", "/file.sh", "./file.sh", ".bashrc",
+        "/home/ely/file.sh", "/home/ely/", "/home/ely", "/home/ely/archive.tar.gz", "file."
+    };
+
+    for ( const string & path : paths )
+    {
+        const PathView view( path );
+
+        BOOST_CHECK_EQUAL( view.dirName(), Path::dirName( path ) );
+        BOOST_CHECK_EQUAL( view.baseName(), Path::baseName( path ) );
+        BOOST_CHECK_EQUAL( view.baseName( ".sh" ), Path::baseName( path, ".sh" ) );
+        BOOST_CHECK_EQUAL( view.extension(), FilePath::extractExtension( Path::baseName( path ) ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( views )
+{
+    const string path( "/home/ely/file.sh" );
+    const PathView view( path );
+
+    // The results point into the parsed string
+    BOOST_CHECK( view.dirName().data() == path.data() );
+    BOOST_CHECK( view.baseName().data() == path.data() + 10 );
+    BOOST_CHECK( view.extension().data() == path.data() + 15 );
+
+    const Path fromPath( path );
+
+    BOOST_CHECK_EQUAL( PathView( fromPath ).baseName(), "file.sh" );
+    BOOST_CHECK_EQUAL( PathView( "short.txt" ).extension(), "txt" );
+}
+
+BOOST_AUTO_TEST_CASE( components )
+{
+    const auto components = [] ( string_view path )
+    {
+        const PathView view( path );
+
+        return vector< string >( view.begin(), view.end() );
+    };
+
+    BOOST_CHECK( components( "" ).empty() );
+    BOOST_CHECK( components( "/" ) == ( vector< string > { "/" } ) );
+    BOOST_CHECK( components( "/home//ely/" ) == ( vector< string > { "/", "home", "ely" } ) );
+    BOOST_CHECK( components( "./file.sh" ) == ( vector< string > { ".", "file.sh" } ) );
+    BOOST_CHECK( components( "home/ely" ) == ( vector< string > { "home", "ely" } ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,285 @@
+/*!
+ * \file StatusCache.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the StatusCache class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/StatusCache.hpp>
+
+
+#if defined ( ELY_USING_LINUX_API )
+
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+BOOST_AUTO_TEST_SUITE( status_cache )
+
+BOOST_AUTO_TEST_CASE( metadata )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    FileStatus status;
+
+    appendFile( path, "12345" );
+
+    BOOST_REQUIRE( getStatus( Path( path ), status ) );
+    BOOST_CHECK( Directory::EntryType::Regular == status.type );
+    BOOST_CHECK_EQUAL( status.size, 5u );
+    BOOST_CHECK_NE( status.inode, 0u );
+    BOOST_CHECK_GT( status.modificationTime, 0 );
+
+    BOOST_REQUIRE( getStatus( Path( directory.path ), status ) );
+    BOOST_CHECK( Directory::EntryType::Directory == status.type );
+
+    std::error_code error;
+
+    BOOST_CHECK( ! getStatus( Path( directory.file( "missing" ) ), status, error ) );
+    BOOST_CHECK_EQUAL( error.value(), ENOENT );
+
+    ::symlink( path.c_str(), directory.file( "link" ).c_str() );
+    BOOST_REQUIRE( getLinkStatus( Path( directory.file( "link" ) ), status ) );
+    BOOST_CHECK( Directory::EntryType::SymbolicLink == status.type );
+}
+
+BOOST_AUTO_TEST_CASE( invalidation )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    StatusCache cache;
+    FileStatus status;
+    std::error_code error;
+
+    BOOST_REQUIRE( cache.isWatching() );
+
+    appendFile( path, "12345" );
+
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 5u );
+    BOOST_CHECK_EQUAL( cache.getNumberOfMisses(), 1u );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits(), 1u );
+
+    // Modified
+    appendFile( path, "678" );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 8u );
+
+    // Touched
+    const ::timespec times[] = { { 1000, 0 }, { 1000, 0 } };
+
+    ::utimensat( AT_FDCWD, path.c_str(), times, 0 );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.modificationTime, 1000000000000LL );
+
+    // Removed, created and replaced
+    std::remove( path.c_str() );
+    BOOST_CHECK( ! cache.getStatus( Path( path ), status, error ) );
+    BOOST_CHECK_EQUAL( error.value(), ENOENT );
+    BOOST_CHECK( ! cache.getStatus( Path( path ), status, error ) );
+    BOOST_CHECK_EQUAL( error.value(), ENOENT );
+
+    appendFile( path, "1" );
+    BOOST_CHECK( cache.getStatus( Path( path ), status, error ) );
+    BOOST_CHECK( ! error );
+    BOOST_CHECK_EQUAL( status.size, 1u );
+
+    const std::string other = directory.file( "other" );
+
+    appendFile( other, "1234" );
+    std::rename( other.c_str(), path.c_str() );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 4u );
+
+    const std::uint64_t hits = cache.getNumberOfHits();
+
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits(), hits + 1 );
+
+    cache.invalidate( Path( path ) );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits(), hits + 1 );
+}
+
+BOOST_AUTO_TEST_CASE( directories_and_links )
+{
+    TemporaryDirectory directory;
+    const std::string subdirectory = directory.file( "subdirectory" );
+    StatusCache cache;
+    FileStatus status;
+
+    ::mkdir( subdirectory.c_str(), 0755 );
+
+    // A directory changes with its files
+    const ::timespec times[] = { { 1000, 0 }, { 1000, 0 } };
+
+    ::utimensat( AT_FDCWD, subdirectory.c_str(), times, 0 );
+    BOOST_CHECK( cache.getStatus( Path( subdirectory ), status ) );
+    BOOST_CHECK_EQUAL( status.modificationTime, 1000000000000LL );
+
+    appendFile( subdirectory + "/file", "1" );
+    BOOST_CHECK( cache.getStatus( Path( subdirectory ), status ) );
+    BOOST_CHECK_NE( status.modificationTime, 1000000000000LL );
+
+    // A removed directory
+    std::remove( ( subdirectory + "/file" ).c_str() );
+    ::rmdir( subdirectory.c_str() );
+    BOOST_CHECK( ! cache.getStatus( Path( subdirectory ), status ) );
+
+    // The target of a link is read each time
+    const std::string link = directory.file( "link" );
+
+    appendFile( directory.file( "first" ), "1" );
+    appendFile( directory.file( "second" ), "22" );
+    ::symlink( directory.file( "first" ).c_str(), link.c_str() );
+    BOOST_CHECK( cache.getStatus( Path( link ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 1u );
+
+    appendFile( directory.file( "first" ), "1" );
+    BOOST_CHECK( cache.getStatus( Path( link ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 2u );
+    BOOST_CHECK( Directory::EntryType::Regular == status.type );
+
+    cache.clear();
+    BOOST_CHECK_EQUAL( cache.getSize(), 0u );
+    BOOST_CHECK_EQUAL( cache.getMemoryUsage(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( queue_overflow )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    StatusCache cache;
+    FileStatus status;
+
+    appendFile( path, "1" );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK( cache.getStatus( Path( directory.path ), status ) );
+    BOOST_CHECK_EQUAL( cache.getSize(), 2u );
+
+    // Alternated between two files so the events are not merged, until the queue overflows
+    std::size_t maximumEvents = 16384;
+    std::ifstream( "/proc/sys/fs/inotify/max_queued_events" ) >> maximumEvents;
+
+    const int first = ::open( directory.file( "first" ).c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644 );
+    const int second = ::open( directory.file( "second" ).c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644 );
+
+    BOOST_REQUIRE( -1 != first && -1 != second );
+
+    for ( std::size_t i = 0; i <= maximumEvents; ++i )
+    {
+        BOOST_REQUIRE_EQUAL( ::write( ( 0 == i % 2 ) ? first : second, "1", 1 ), 1 );
+    }
+
+    ::close( first );
+    ::close( second );
+
+    // The event of this change is lost
+    appendFile( path, "2" );
+
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 2u );
+    BOOST_CHECK_EQUAL( cache.getSize(), 1u );
+
+    // Watched again once the queue is read
+    appendFile( path, "3" );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 3u );
+}
+
+BOOST_AUTO_TEST_CASE( memory_budget )
+{
+    TemporaryDirectory directory;
+    StatusCache cache( 4096 );
+    FileStatus status;
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        appendFile( directory.file( std::to_string( i ) ), "1" );
+        BOOST_CHECK( cache.getStatus( Path( directory.file( std::to_string( i ) ) ), status ) );
+    }
+
+    BOOST_CHECK_LE( cache.getMemoryUsage(), 4096u );
+    BOOST_CHECK_GT( cache.getSize(), 0u );
+    BOOST_CHECK_LT( cache.getSize(), 200u );
+
+    // The most recently used entries are kept
+    const std::uint64_t hits = cache.getNumberOfHits();
+
+    BOOST_CHECK( cache.getStatus( Path( directory.file( "199" ) ), status ) );
+    BOOST_CHECK_EQUAL( cache.getNumberOfHits(), hits + 1 );
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_queries )
+{
+    TemporaryDirectory directory;
+    const std::string path = directory.file( "file" );
+    StatusCache cache;
+    std::atomic< bool > isRunning( true );
+    std::atomic< int > failures( 0 );
+    std::vector< std::thread > threads;
+
+    appendFile( path, "" );
+
+    for ( int t = 0; t < 4; ++t )
+    {
+        threads.emplace_back( [ & ]
+        {
+            FileStatus status;
+            std::uint64_t lastSize = 0;
+
+            while ( isRunning )
+            {
+                // The size only grows
+                failures += ! cache.getStatus( Path( path ), status ) || status.size < lastSize;
+                lastSize = status.size;
+            }
+        } );
+    }
+
+    for ( int i = 0; i < 500; ++i )
+    {
+        appendFile( path, "1" );
+    }
+
+    isRunning = false;
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    FileStatus status;
+
+    BOOST_CHECK_EQUAL( failures, 0 );
+    BOOST_CHECK( cache.getStatus( Path( path ), status ) );
+    BOOST_CHECK_EQUAL( status.size, 500u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_USING_LINUX_API
@@ -0,0 +1,107 @@
+/*!
+ * \file normalization.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the normalization of the paths.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include <ely/file_system/FilePath.hpp>
+#include <ely/file_system/normalization.hpp>
+
+
+using ::std::string;
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+string normalized( string pathString )
+{
+    pathString.resize( normalizeInPlace( &pathString[ 0 ], pathString.size() ) );
+
+    return pathString;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( normalization )
+
+BOOST_AUTO_TEST_CASE( normalize_in_place )
+{
+    BOOST_CHECK_EQUAL( normalized( "" ), "" );
+    BOOST_CHECK_EQUAL( normalized( "." ), "." );
+    BOOST_CHECK_EQUAL( normalized( "./" ), "." );
+    BOOST_CHECK_EQUAL( normalized( "/" ), "/" );
+    BOOST_CHECK_EQUAL( normalized( "//" ), "/" );
+    BOOST_CHECK_EQUAL( normalized( "/.." ), "/" );
+    BOOST_CHECK_EQUAL( normalized( "/../home" ), "/home" );
+    BOOST_CHECK_EQUAL( normalized( ".." ), ".." );
+    BOOST_CHECK_EQUAL( normalized( "../../a/.." ), "../.." );
+    BOOST_CHECK_EQUAL( normalized( "a/.." ), "." );
+    BOOST_CHECK_EQUAL( normalized( "a/../.." ), ".." );
+    BOOST_CHECK_EQUAL( normalized( "./home//ely/../ely/./script.sh" ), "home/ely/script.sh" );
+    BOOST_CHECK_EQUAL( normalized( "/home/ely/directory/" ), "/home/ely/directory" );
+    BOOST_CHECK_EQUAL( normalized( "/home/./ely/.../file" ), "/home/ely/.../file" );
+}
+
+BOOST_AUTO_TEST_CASE( normalized_path_view )
+{
+    const NormalizedPathView shortPath( "/home//ely/../script.sh" );
+
+    BOOST_CHECK_EQUAL( shortPath.toString(), "/home/script.sh" );
+
+    const string longPathString = "/" + string( NormalizedPathView::inlineCapacity(), 'a' ) + "/../b";
+    const NormalizedPathView longPath( longPathString );
+
+    BOOST_CHECK_EQUAL( longPath.toString(), "/b" );
+}
+
+BOOST_AUTO_TEST_CASE( path )
+{
+    Path path( "/home/./ely//directory/../script.sh" );
+
+    path.normalize();
+
+    BOOST_CHECK_EQUAL( path.toString(), "/home/ely/script.sh" );
+    BOOST_CHECK_EQUAL( path.getAccessPath(), "/home/ely" );
+    BOOST_CHECK_EQUAL( path.getName(), "script.sh" );
+
+    Path relativePath( "directory/../script.sh" );
+
+    relativePath.normalize();
+
+    BOOST_CHECK_EQUAL( relativePath.toString(), "./script.sh" );
+    BOOST_CHECK_EQUAL( relativePath.getName(), "script.sh" );
+
+    FilePath filePath( "/home/ely/../ely/archive.tar.gz" );
+
+    filePath.normalize();
+
+    BOOST_CHECK_EQUAL( filePath.toString(), "/home/ely/archive.tar.gz" );
+    BOOST_CHECK_EQUAL( filePath.getExtension(), "gz" );
+}
+
+BOOST_AUTO_TEST_CASE( comparison )
+{
+    const Path first( "/home/ely/script.sh" );
+    const Path second( "/home//ely/./directory/../script.sh" );
+
+    BOOST_CHECK( ! ( first == second ) );
+    BOOST_CHECK( ! isEqual( first, second ) );
+    BOOST_CHECK( isEqual( first, second, PathComparison::Normalized ) );
+    BOOST_CHECK( ! isEqual( first, Path( "/home/script.sh" ), PathComparison::Normalized ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
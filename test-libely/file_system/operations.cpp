@@ -0,0 +1,153 @@
+/*!
+ * \file operations.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the copy and the move of the files.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <ely/file_system/File.hpp>
+#include <ely/file_system/operations.hpp>
+
+
+#if defined ( ELY_POSIX_API )
+
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "temporary.hpp"
+
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+bool exists( const std::string & path )
+{
+    return 0 == ::access( path.c_str(), F_OK );
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( operations )
+
+BOOST_AUTO_TEST_CASE( copy_file )
+{
+    TemporaryDirectory directory;
+    std::string content;
+
+    // Larger than the buffer of the read and write loop
+    for ( int i = 0; content.size() < 3 * 1024 * 1024; ++i )
+    {
+        content += std::to_string( i ) + '\n';
+    }
+
+    std::ofstream( directory.file( "source" ), std::ios_base::binary ) << content;
+    ::chmod( directory.file( "source" ).c_str(), 0751 );
+    std::ofstream( directory.file( "destination" ) ) << "replaced content which is long";
+
+    std::error_code error;
+
+    BOOST_CHECK( copyFile( FilePath( directory.file( "source" ) ), FilePath( directory.file( "destination" ) ), error ) );
+    BOOST_CHECK( ! error );
+    BOOST_CHECK( content == readFile( directory.file( "destination" ) ) );
+
+    struct stat status;
+
+    ::stat( directory.file( "destination" ).c_str(), &status );
+    BOOST_CHECK_EQUAL( status.st_mode & 0777, 0751u );
+
+    // Empty file
+    std::ofstream( directory.file( "empty" ) );
+
+    BOOST_CHECK( copyFile( FilePath( directory.file( "empty" ) ), FilePath( directory.file( "destination" ) ) ) );
+    BOOST_CHECK( readFile( directory.file( "destination" ) ).empty() );
+
+    // Failures
+    BOOST_CHECK( ! copyFile( FilePath( directory.file( "missing" ) ), FilePath( directory.file( "copy" ) ), error ) );
+    BOOST_CHECK( std::errc::no_such_file_or_directory == error );
+    BOOST_CHECK( ! exists( directory.file( "copy" ) ) );
+
+    BOOST_CHECK( ! copyFile( FilePath( directory.file( "source" ) ), FilePath( directory.file( "source" ) ), error ) );
+    BOOST_CHECK( std::errc::invalid_argument == error );
+    BOOST_CHECK( content == readFile( directory.file( "source" ) ) );
+
+    BOOST_CHECK( ! copyFile( FilePath( directory.path ), FilePath( directory.file( "copy" ) ), error ) );
+    BOOST_CHECK( std::errc::is_a_directory == error );
+}
+
+BOOST_AUTO_TEST_CASE( move_file )
+{
+    TemporaryDirectory directory;
+    std::error_code error;
+
+    std::ofstream( directory.file( "source" ) ) << "ely";
+
+    BOOST_CHECK( moveFile( FilePath( directory.file( "source" ) ), FilePath( directory.file( "moved" ) ), error ) );
+    BOOST_CHECK( ! error );
+    BOOST_CHECK( ! exists( directory.file( "source" ) ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "moved" ) ), "ely" );
+
+    BOOST_CHECK( ! moveFile( FilePath( directory.file( "source" ) ), FilePath( directory.file( "moved" ) ), error ) );
+    BOOST_CHECK( std::errc::no_such_file_or_directory == error );
+
+    // Another file system, when available
+    TemporaryDirectory other( "/dev/shm" );
+    struct stat status;
+    struct stat otherStatus;
+
+    if ( ! other.path.empty() && 0 == ::stat( directory.path.c_str(), &status ) &&
+         0 == ::stat( other.path.c_str(), &otherStatus ) && status.st_dev != otherStatus.st_dev )
+    {
+        BOOST_CHECK( moveFile( FilePath( directory.file( "moved" ) ), FilePath( other.file( "moved" ) ), error ) );
+        BOOST_CHECK( ! error );
+        BOOST_CHECK( ! exists( directory.file( "moved" ) ) );
+        BOOST_CHECK_EQUAL( readFile( other.file( "moved" ) ), "ely" );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( file )
+{
+    TemporaryDirectory directory;
+    File file( FilePath( directory.file( "file.txt" ) ) );
+
+    BOOST_REQUIRE( file.isOpen() );
+
+    // The pending writes are copied
+    file << "ely";
+
+    BOOST_CHECK( file.copyTo( FilePath( directory.file( "copy.txt" ) ) ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "copy.txt" ) ), "ely" );
+
+    BOOST_CHECK( file.moveTo( FilePath( directory.file( "moved.txt" ) ) ) );
+    BOOST_CHECK( file.isOpen() );
+    BOOST_CHECK_EQUAL( file.getPath().toString(), directory.file( "moved.txt" ) );
+    BOOST_CHECK( ! exists( directory.file( "file.txt" ) ) );
+
+    BOOST_CHECK( file.rename( std::string( "renamed.txt" ) ) );
+    BOOST_CHECK_EQUAL( file.getPath().toString(), directory.file( "renamed.txt" ) );
+    BOOST_CHECK_EQUAL( readFile( directory.file( "renamed.txt" ) ), "ely" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif // ELY_POSIX_API
@@ -0,0 +1,100 @@
+/*!
+ * \file separators.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the separators' kernels.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <ely/file_system/separators.hpp>
+
+
+using ::std::string;
+
+using namespace ely::file_system;
+
+
+namespace
+{
+
+
+/// Checks every function of the selected kernel against the standard library.
+bool matchesStandardLibrary( const string & pathString )
+{
+    bool isMatching = true;
+
+    for ( ::std::size_t from = 0; from <= pathString.size(); ++from )
+    {
+        const ::std::size_t expected = pathString.find_first_of( "/\\", from );
+
+        isMatching = isMatching && ( expected == separators::findFirst( pathString, '/', '\\', from ) );
+    }
+
+    isMatching = isMatching && ( pathString.find_last_of( "/\\" ) == separators::findLast( pathString, '/', '\\' ) );
+    isMatching = isMatching && ( pathString.find_last_of( '/' ) == separators::findLast( pathString, '/', '/' ) );
+
+    string expected( pathString );
+    string replaced( pathString );
+
+    ::std::replace( expected.begin(), expected.end(), '\\', '/' );
+    separators::replace( &replaced[ 0 ], replaced.size(), '\\', '/' );
+
+    return isMatching && expected == replaced;
+}
+
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( separators_kernels )
+
+BOOST_AUTO_TEST_CASE( kernels )
+{
+    BOOST_CHECK( separators::isSupported( separators::Kernel::Scalar ) );
+    BOOST_CHECK( separators::isSupported( separators::getKernel() ) );
+
+    const separators::Kernel selectedKernel = separators::getKernel();
+    ::std::mt19937 random( 42 );
+    ::std::uniform_int_distribution< int > randomCharacter( 0, 7 );
+
+    for ( separators::Kernel kernel : { separators::Kernel::Scalar, separators::Kernel::Sse2, separators::Kernel::Avx2 } )
+    {
+        if ( ! separators::setKernel( kernel ) )
+        {
+            continue;
+        }
+
+        BOOST_CHECK( kernel == separators::getKernel() );
+
+        // Every length around the sizes of the blocks
+        bool isMatching = true;
+
+        for ( ::std::size_t size = 0; size < 100; ++size )
+        {
+            string pathString( size, 'a' );
+
+            for ( char & character : pathString )
+            {
+                const int value = randomCharacter( random );
+
+                character = ( 0 == value ) ? '/' : ( ( 1 == value ) ? '\\' : 'a' );
+            }
+
+            isMatching = isMatching && matchesStandardLibrary( pathString ) && matchesStandardLibrary( string( size, 'a' ) );
+        }
+
+        BOOST_CHECK( isMatching );
+    }
+
+    separators::setKernel( selectedKernel );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
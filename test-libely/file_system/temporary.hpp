@@ -0,0 +1,169 @@
+/*!
+ * \file temporary.hpp
+ *
+ * \brief Temporary files and directories of the file system tests.
+ *
+ * \author Ely
+ */
+#ifndef TEST_LIBELY_FILE_SYSTEM_TEMPORARY_HPP
+#define TEST_LIBELY_FILE_SYSTEM_TEMPORARY_HPP
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+#include <ftw.h>
+#include <unistd.h>
+
+
+/*!
+ * \brief Remove a file or a whole directory tree.
+ *
+ * The symbolic links are removed, not followed.
+ *
+ * \param path The path to remove.
+ */
+inline void removeTree( const std::string & path )
+{
+    const auto removeEntry = []( const char * entryPath, const struct stat *, int, struct FTW * )
+    {
+        std::remove( entryPath );
+
+        // Keep removing the other entries
+        return 0;
+    };
+
+    ::nftw( path.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS );
+}
+
+/*!
+ * \brief Read a whole file.
+ *
+ * \param path The path of the file.
+ *
+ * \return The content of the file, empty if it can't be read.
+ */
+inline std::string readFile( const std::string & path )
+{
+    std::ifstream stream( path, std::ios_base::binary );
+
+    return std::string( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+}
+
+/*!
+ * \brief Replace the content of a file, the file is created if needed.
+ *
+ * \param path      The path of the file.
+ * \param content   The new content of the file.
+ */
+inline void writeFile( const std::string & path, const std::string & content )
+{
+    std::ofstream stream( path, std::ios_base::binary );
+
+    stream << content;
+}
+
+/*!
+ * \brief Append to a file, the file is created if needed.
+ *
+ * \param path      The path of the file.
+ * \param content   The content to append.
+ */
+inline void appendFile( const std::string & path, const std::string & content )
+{
+    std::ofstream stream( path, std::ios_base::binary | std::ios_base::app );
+
+    stream << content;
+}
+
+
+/// A temporary directory removed with its content at the end of the test.
+struct TemporaryDirectory
+{
+    /*!
+     * \brief Constructor
+     *
+     * \param parent The directory in which the temporary directory is created.
+     *
+     * The path is empty if the directory can't be created.
+     */
+    explicit TemporaryDirectory( const std::string & parent = "/tmp" )
+    {
+        std::string pattern( parent + "/ely-test-XXXXXX" );
+
+        if ( nullptr != ::mkdtemp( &pattern[ 0 ] ) )
+        {
+            path = pattern;
+        }
+    }
+
+    ~TemporaryDirectory()
+    {
+        if ( ! path.empty() )
+        {
+            removeTree( path );
+        }
+    }
+
+    TemporaryDirectory( const TemporaryDirectory & ) = delete;
+    TemporaryDirectory & operator =( const TemporaryDirectory & ) = delete;
+
+    /// The path of the entry \p name of the directory.
+    std::string file( const std::string & name ) const
+    {
+        return path + '/' + name;
+    }
+
+
+    std::string path;
+};
+
+
+/// A temporary file removed at the end of the test.
+struct TemporaryFile
+{
+    /*!
+     * \brief Constructor
+     *
+     * \param content The initial content of the file.
+     */
+    explicit TemporaryFile( const std::string & content = std::string() )
+    {
+        char pattern[] = "/tmp/ely-test-XXXXXX";
+        const int descriptor = ::mkstemp( pattern );
+
+        if ( -1 != descriptor )
+        {
+            ::close( descriptor );
+            path = pattern;
+            writeFile( path, content );
+        }
+    }
+
+    ~TemporaryFile()
+    {
+        if ( ! path.empty() )
+        {
+            std::remove( path.c_str() );
+        }
+    }
+
+    TemporaryFile( const TemporaryFile & ) = delete;
+    TemporaryFile & operator =( const TemporaryFile & ) = delete;
+
+    /// The content of the file.
+    std::string read() const
+    {
+        return readFile( path );
+    }
+
+
+    std::string path;
+};
+
+
+#endif // TEST_LIBELY_FILE_SYSTEM_TEMPORARY_HPP
@@ -0,0 +1,166 @@
+/*!
+ * \file SignalRecorder.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the SignalRecorder and SignalReplayer classes.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <ely/signals_slots/SignalsSlots.hpp>
+#include <ely/signals_slots/SignalRecorder.hpp>
+#include <ely/signals_slots/SignalReplayer.hpp>
+
+
+using ::ely::signals_slots::Signal;
+using ::ely::signals_slots::SignalRecorder;
+using ::ely::signals_slots::SignalReplayer;
+using ::ely::signals_slots::Slot;
+using ::ely::signals_slots::connect;
+
+
+BOOST_AUTO_TEST_SUITE( signal_recorder )
+
+BOOST_AUTO_TEST_CASE( record_and_replay )
+{
+    typedef SignalReplayer< int, const ::std::string & > Replayer;
+
+    ::std::stringstream record;
+    Signal< int, const ::std::string & > recorded;
+
+    {
+        SignalRecorder< int, const ::std::string & > recorder( recorded, record );
+
+        recorded( 1, "first" );
+        recorded( -2, "" );
+        recorded( 300000, ::std::string( 200, 'x' ) );
+
+        BOOST_CHECK_EQUAL( recorder.getCount(), 3u );
+    }
+
+    recorded( 4, "not recorded" );
+
+
+    Signal< int, const ::std::string & > replayed;
+    Slot< int, const ::std::string & > slot;
+    ::std::vector< int > numbers;
+    ::std::vector< ::std::string > texts;
+
+    slot.bind( [ & ]( int number, const ::std::string & text )
+    {
+        numbers.push_back( number );
+        texts.push_back( text );
+    } );
+    connect( replayed, slot );
+
+    Replayer replayer( record );
+
+    BOOST_CHECK( replayer.isValid() );
+    BOOST_CHECK_EQUAL( replayer.replay( replayed, Replayer::Speed::Maximum ), 3u );
+    BOOST_CHECK( replayer.isValid() );
+
+    BOOST_REQUIRE_EQUAL( numbers.size(), 3u );
+    BOOST_CHECK_EQUAL( numbers[ 0 ], 1 );
+    BOOST_CHECK_EQUAL( numbers[ 1 ], -2 );
+    BOOST_CHECK_EQUAL( numbers[ 2 ], 300000 );
+    BOOST_CHECK_EQUAL( texts[ 0 ], "first" );
+    BOOST_CHECK_EQUAL( texts[ 1 ], "" );
+    BOOST_CHECK_EQUAL( texts[ 2 ], ::std::string( 200, 'x' ) );
+}
+
+BOOST_AUTO_TEST_CASE( recorded_speed )
+{
+    ::std::stringstream record;
+    Signal< > recorded;
+
+    {
+        SignalRecorder< > recorder( recorded, record );
+
+        recorded();
+        ::std::this_thread::sleep_for( ::std::chrono::milliseconds( 20 ) );
+        recorded();
+    }
+
+    Signal< > replayed;
+    SignalReplayer< > replayer( record );
+
+    const auto start = ::std::chrono::steady_clock::now();
+
+    BOOST_CHECK_EQUAL( replayer.replay( replayed ), 2u );
+    BOOST_CHECK( ::std::chrono::steady_clock::now() - start >= ::std::chrono::milliseconds( 20 ) );
+}
+
+BOOST_AUTO_TEST_CASE( invalid_records )
+{
+    ::std::stringstream record;
+
+    {
+        Signal< int > recorded;
+        SignalRecorder< int > recorder( recorded, record );
+
+        recorded( 1 );
+    }
+
+    // The number of arguments doesn't match
+    ::std::stringstream otherSignature( record.str() );
+    SignalReplayer< int, int > otherReplayer( otherSignature );
+
+    BOOST_CHECK( ! otherReplayer.isValid() );
+
+    // The number of arguments matches but not their types
+    ::std::stringstream otherTypes( record.str() );
+    SignalReplayer< float > floatReplayer( otherTypes );
+
+    BOOST_CHECK( ! floatReplayer.isValid() );
+
+    ::std::stringstream otherSigns( record.str() );
+    SignalReplayer< unsigned int > unsignedReplayer( otherSigns );
+
+    BOOST_CHECK( ! unsignedReplayer.isValid() );
+
+    // The last emission is truncated
+    ::std::string truncatedRecord = record.str();
+    truncatedRecord.pop_back();
+
+    ::std::stringstream truncated( truncatedRecord );
+    Signal< int > replayed;
+    SignalReplayer< int > replayer( truncated );
+
+    BOOST_CHECK( replayer.isValid() );
+    BOOST_CHECK_EQUAL( replayer.replay( replayed ), 0u );
+    BOOST_CHECK( ! replayer.isValid() );
+}
+
+BOOST_AUTO_TEST_CASE( corrupted_string_size )
+{
+    ::std::string value = "previous";
+
+    // A size of 2^56 followed by only three characters
+    ::std::stringstream corrupted( ::std::string( "\x80\x80\x80\x80\x80\x80\x80\x80\x01" "abc" ) );
+
+    ::ely::signals_slots::Serializer< ::std::string >::read( corrupted, value );
+
+    BOOST_CHECK( corrupted.fail() );
+    BOOST_CHECK( value.size() < 4096u );
+
+    ::std::stringstream valid;
+
+    ::ely::signals_slots::Serializer< ::std::string >::write( valid, ::std::string( 10000, 'x' ) );
+    ::ely::signals_slots::Serializer< ::std::string >::read( valid, value );
+
+    BOOST_CHECK( ! valid.fail() );
+    BOOST_CHECK_EQUAL( value, ::std::string( 10000, 'x' ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
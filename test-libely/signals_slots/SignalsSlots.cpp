@@ -4,13 +4,16 @@
 #include <iostream>
 
 
-#include <ely/signals_slots/Signal.hpp>
-#include <ely/signals_slots/Slot.hpp>
+#include <ely/signals_slots/SignalsSlots.hpp>
 
 
+using ::ely::signals_slots::BlockableSignal;
 using ::ely::signals_slots::Signal;
+using ::ely::signals_slots::SignalBlocker;
 using ::ely::signals_slots::Slot;
 using ::ely::signals_slots::connect;
+using ::ely::signals_slots::disconnect;
+using ::ely::signals_slots::isBlocked;
 
 class Server
 {
@@ -124,4 +127,90 @@ BOOST_AUTO_TEST_CASE( signals_slots )
     server.disconnect(); // Print : You are now disconnected.
 }
 
+BOOST_AUTO_TEST_CASE( signals_slots_disconnect_while_emitting )
+{
+    Signal< int > aSignal;
+    Slot< int > first;
+    Slot< int > second;
+    Slot< int > third;
+    int firstCalls = 0;
+    int secondCalls = 0;
+    int thirdCalls = 0;
+
+    // The first slot disconnects itself and the second one
+    first.bind( [ & ]( int )
+    {
+        ++firstCalls;
+        disconnect( aSignal, first );
+        disconnect( aSignal, second );
+        connect( aSignal, third );
+    } );
+    second.bind( [ & ]( int ) { ++secondCalls; } );
+    third.bind( [ & ]( int ) { ++thirdCalls; } );
+
+    connect( aSignal, first );
+    connect( aSignal, second );
+
+    aSignal( 1 );
+
+    BOOST_CHECK_EQUAL( firstCalls, 1 );
+    BOOST_CHECK_EQUAL( secondCalls, 0 );
+    BOOST_CHECK_EQUAL( thirdCalls, 0 ); // Connected during the emission
+
+    aSignal( 2 );
+
+    BOOST_CHECK_EQUAL( firstCalls, 1 );
+    BOOST_CHECK_EQUAL( secondCalls, 0 );
+    BOOST_CHECK_EQUAL( thirdCalls, 1 );
+}
+
+BOOST_AUTO_TEST_CASE( signals_slots_blocking )
+{
+    BlockableSignal< int > aSignal;
+    Slot< int > first;
+    Slot< int > second;
+    int firstCalls = 0;
+    int secondCalls = 0;
+
+    first.bind( [ & ]( int ) { ++firstCalls; } );
+    second.bind( [ & ]( int ) { ++secondCalls; } );
+
+    connect( aSignal, first );
+    connect( aSignal, second );
+
+    {
+        SignalBlocker< int > signalBlocker( aSignal );
+
+        BOOST_CHECK( aSignal.isBlocked() );
+
+        aSignal( 1 ); // Call nothing
+    }
+
+    BOOST_CHECK( ! aSignal.isBlocked() );
+    BOOST_CHECK_EQUAL( firstCalls, 0 );
+    BOOST_CHECK_EQUAL( secondCalls, 0 );
+
+    {
+        SignalBlocker< int > firstBlocker( aSignal, first );
+
+        {
+            SignalBlocker< int > nestedBlocker( aSignal, first );
+        }
+
+        BOOST_CHECK( isBlocked( aSignal, first ) );
+        BOOST_CHECK( ! isBlocked( aSignal, second ) );
+
+        aSignal( 2 ); // Call only the second slot
+    }
+
+    BOOST_CHECK( ! isBlocked( aSignal, first ) );
+    BOOST_CHECK_EQUAL( firstCalls, 0 );
+    BOOST_CHECK_EQUAL( secondCalls, 1 );
+
+    aSignal( 3 );
+
+    BOOST_CHECK_EQUAL( firstCalls, 1 );
+    BOOST_CHECK_EQUAL( secondCalls, 2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,5 @@
 TEMPLATE = app
-CONFIG += console c++14
+CONFIG += console c++17
 CONFIG -= app_bundle
 CONFIG -= qt
 
@@ -35,11 +35,33 @@ SOURCES += main.cpp \
     patterns/Composite.cpp \
     file_system/FilePath.cpp \
     file_system/Path.cpp \
+    file_system/PathView.cpp \
+    file_system/PathTable.cpp \
+    file_system/separators.cpp \
+    file_system/normalization.cpp \
+    file_system/Directory.cpp \
+    file_system/DirectoryWalker.cpp \
+    file_system/MappedFile.cpp \
+    file_system/operations.cpp \
+    file_system/AsyncFile.cpp \
+    file_system/File.cpp \
+    file_system/BufferedWriter.cpp \
+    file_system/LineReader.cpp \
+    file_system/ChunkedReader.cpp \
+    file_system/AtomicFileWriter.cpp \
+    file_system/FileHandleCache.cpp \
+    file_system/StatusCache.cpp \
+    file_system/FileWatcher.cpp \
+    utilities/WorkStealingThreadPool.cpp \
     utilities/ElyLog.cpp \
     file_system/AbstractFile.cpp \
     signals_slots/SignalsSlots.cpp \
+    signals_slots/SignalRecorder.cpp \
     utilities/IntegerSequence.cpp \
-    utilities/bind.cpp
+    utilities/bind.cpp \
+    utilities/SpscQueue.cpp \
+    utilities/MpmcQueue.cpp
 
-HEADERS +=
+HEADERS += \
+    file_system/temporary.hpp
 
@@ -0,0 +1,107 @@
+/*!
+ * \file MpmcQueue.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the MpmcQueue class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+#include <ely/utilities/MpmcQueue.hpp>
+
+
+using ::ely::utilities::MpmcQueue;
+
+
+BOOST_AUTO_TEST_SUITE( mpmc_queue )
+
+BOOST_AUTO_TEST_CASE( capacity )
+{
+    MpmcQueue< int > queue( 3 );
+
+    BOOST_CHECK_EQUAL( queue.getCapacity(), 4u );
+    BOOST_CHECK( queue.isEmpty() );
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        BOOST_CHECK( queue.tryPush( i ) );
+    }
+
+    BOOST_CHECK( ! queue.tryPush( 4 ) );
+    BOOST_CHECK_EQUAL( queue.getSize(), 4u );
+}
+
+BOOST_AUTO_TEST_CASE( fifo )
+{
+    MpmcQueue< ::std::string > queue( 4 );
+    ::std::string value;
+
+    BOOST_CHECK( ! queue.tryPop( value ) );
+
+    // Goes around the ring buffer several times
+    for ( int i = 0; i < 10; ++i )
+    {
+        BOOST_CHECK( queue.tryEmplace( 3, 'a' + i ) );
+        BOOST_CHECK( queue.tryPush( ::std::to_string( i ) ) );
+
+        BOOST_CHECK( queue.tryPop( value ) );
+        BOOST_CHECK_EQUAL( value, ::std::string( 3, 'a' + i ) );
+        BOOST_CHECK( queue.tryPop( value ) );
+        BOOST_CHECK_EQUAL( value, ::std::to_string( i ) );
+    }
+
+    BOOST_CHECK( queue.isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( batch )
+{
+    MpmcQueue< int > queue( 8 );
+    const ::std::vector< int > input { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    ::std::vector< int > output;
+
+    BOOST_CHECK_EQUAL( queue.tryPushBatch( input.begin(), input.end() ), 8u );
+    BOOST_CHECK_EQUAL( queue.tryPopBatch( ::std::back_inserter( output ), 3 ), 3u );
+    BOOST_CHECK_EQUAL( queue.tryPushBatch( input.begin() + 8, input.end() ), 2u );
+    BOOST_CHECK_EQUAL( queue.tryPopBatch( ::std::back_inserter( output ), 100 ), 7u );
+    BOOST_CHECK_EQUAL( queue.tryPopBatch( ::std::back_inserter( output ), 100 ), 0u );
+
+    BOOST_CHECK_EQUAL_COLLECTIONS( output.begin(), output.end(), input.begin(), input.end() );
+}
+
+BOOST_AUTO_TEST_CASE( remaining_elements )
+{
+    auto element = ::std::make_shared< int >( 0 );
+
+    {
+        MpmcQueue< ::std::shared_ptr< int > > queue( 4 );
+        ::std::shared_ptr< int > value;
+
+        // Leaves the remaining elements across the end of the ring buffer
+        for ( int i = 0; i < 3; ++i )
+        {
+            queue.tryPush( element );
+        }
+
+        queue.tryPop( value );
+        queue.tryPop( value );
+        value.reset();
+        queue.tryPush( element );
+        queue.tryPush( element );
+
+        BOOST_CHECK_EQUAL( element.use_count(), 4 );
+    }
+
+    BOOST_CHECK_EQUAL( element.use_count(), 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+/*!
+ * \file SpscQueue.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the SpscQueue class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <ely/utilities/SpscQueue.hpp>
+
+
+using ::ely::utilities::SpscQueue;
+
+
+BOOST_AUTO_TEST_SUITE( spsc_queue )
+
+BOOST_AUTO_TEST_CASE( capacity )
+{
+    SpscQueue< int > queue( 5 );
+
+    BOOST_CHECK_EQUAL( queue.getCapacity(), 8u );
+    BOOST_CHECK( queue.isEmpty() );
+
+    for ( int i = 0; i < 8; ++i )
+    {
+        BOOST_CHECK( queue.tryPush( i ) );
+    }
+
+    BOOST_CHECK( ! queue.tryPush( 8 ) );
+    BOOST_CHECK_EQUAL( queue.getSize(), 8u );
+}
+
+BOOST_AUTO_TEST_CASE( fifo )
+{
+    SpscQueue< ::std::string > queue( 4 );
+    ::std::string value;
+
+    BOOST_CHECK( ! queue.tryPop( value ) );
+
+    // Goes around the ring buffer several times
+    for ( int i = 0; i < 10; ++i )
+    {
+        BOOST_CHECK( queue.tryEmplace( 3, 'a' + i ) );
+        BOOST_CHECK( queue.tryPush( ::std::to_string( i ) ) );
+
+        BOOST_CHECK( queue.tryPop( value ) );
+        BOOST_CHECK_EQUAL( value, ::std::string( 3, 'a' + i ) );
+        BOOST_CHECK( queue.tryPop( value ) );
+        BOOST_CHECK_EQUAL( value, ::std::to_string( i ) );
+    }
+
+    BOOST_CHECK( queue.isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( batch )
+{
+    SpscQueue< int > queue( 8 );
+    const ::std::vector< int > input { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    ::std::vector< int > output;
+
+    BOOST_CHECK_EQUAL( queue.tryPushBatch( input.begin(), input.end() ), 8u );
+    BOOST_CHECK_EQUAL( queue.tryPopBatch( ::std::back_inserter( output ), 3 ), 3u );
+    BOOST_CHECK_EQUAL( queue.tryPushBatch( input.begin() + 8, input.end() ), 2u );
+    BOOST_CHECK_EQUAL( queue.tryPopBatch( ::std::back_inserter( output ), 100 ), 7u );
+
+    BOOST_CHECK_EQUAL_COLLECTIONS( output.begin(), output.end(), input.begin(), input.end() );
+}
+
+BOOST_AUTO_TEST_CASE( remaining_elements )
+{
+    auto element = ::std::make_shared< int >( 0 );
+
+    {
+        SpscQueue< ::std::shared_ptr< int > > queue( 4 );
+
+        queue.tryPush( element );
+        queue.tryPush( element );
+
+        BOOST_CHECK_EQUAL( element.use_count(), 3 );
+    }
+
+    BOOST_CHECK_EQUAL( element.use_count(), 1 );
+}
+
+BOOST_AUTO_TEST_CASE( threads )
+{
+    const int count = 100000;
+    SpscQueue< int > queue( 64 );
+    ::std::vector< int > output;
+
+    ::std::thread producer( [ & ]
+    {
+        for ( int i = 0; i < count; )
+        {
+            if ( queue.tryPush( i ) )
+            {
+                ++i;
+            }
+        }
+    } );
+
+    while ( output.size() < static_cast< ::std::size_t >( count ) )
+    {
+        queue.tryPopBatch( ::std::back_inserter( output ), 16 );
+    }
+
+    producer.join();
+
+    bool isOrdered = true;
+
+    for ( int i = 0; i < count; ++i )
+    {
+        isOrdered = isOrdered && ( output[ i ] == i );
+    }
+
+    BOOST_CHECK( isOrdered );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/*!
+ * \file WorkStealingThreadPool.cpp
+ *
+ * \brief Tests program.
+ *
+ * \author Ely
+ *
+ * Test program for the WorkStealingThreadPool class.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+
+#include <ely/utilities/WorkStealingThreadPool.hpp>
+
+
+using ::ely::utilities::WorkStealingThreadPool;
+
+
+BOOST_AUTO_TEST_SUITE( work_stealing_thread_pool )
+
+BOOST_AUTO_TEST_CASE( constructors )
+{
+    WorkStealingThreadPool pool( 3 );
+
+    BOOST_CHECK_EQUAL( pool.getNumberOfThreads(), 3u );
+
+    WorkStealingThreadPool single( 0 );
+
+    BOOST_CHECK_EQUAL( single.getNumberOfThreads(), 1u );
+
+    // Nothing to wait for
+    single.wait();
+}
+
+BOOST_AUTO_TEST_CASE( tasks )
+{
+    WorkStealingThreadPool pool( 4 );
+    ::std::atomic< int > sum( 0 );
+
+    for ( int i = 1; i <= 1000; ++i )
+    {
+        pool.submit( [ &sum, i ] { sum += i; } );
+    }
+
+    pool.wait();
+
+    BOOST_CHECK_EQUAL( sum, 500500 );
+
+    // The pool can be reused
+    pool.submit( [ &sum ] { sum = 0; } );
+    pool.wait();
+
+    BOOST_CHECK_EQUAL( sum, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( recursive_tasks )
+{
+    WorkStealingThreadPool pool( 4 );
+    ::std::atomic< int > leaves( 0 );
+    ::std::function< void( int ) > split;
+
+    // A binary tree of tasks of depth 10
+    split = [ & ]( int depth )
+    {
+        if ( 0 == depth )
+        {
+            ++leaves;
+        }
+        else
+        {
+            pool.submit( [ &, depth ] { split( depth - 1 ); } );
+            pool.submit( [ &, depth ] { split( depth - 1 ); } );
+        }
+    };
+
+    pool.submit( [ & ] { split( 10 ); } );
+    pool.wait();
+
+    BOOST_CHECK_EQUAL( leaves, 1024 );
+}
+
+BOOST_AUTO_TEST_CASE( exceptions )
+{
+    WorkStealingThreadPool pool( 2 );
+    ::std::atomic< int > count( 0 );
+
+    pool.submit( [] { throw ::std::runtime_error( "task" ); } );
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        pool.submit( [ &count ] { ++count; } );
+    }
+
+    BOOST_CHECK_THROW( pool.wait(), ::std::runtime_error );
+    BOOST_CHECK_EQUAL( count, 10 );
+
+    // The exception is reported once
+    pool.wait();
+}
+
+BOOST_AUTO_TEST_SUITE_END()